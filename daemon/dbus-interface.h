@@ -28,9 +28,11 @@
 
 #define DBUS_PIPELINE_I_SET_HANDLER             "handle-set-pipeline"
 #define DBUS_PIPELINE_I_GET_HANDLER             "handle-get-pipeline"
+#define DBUS_PIPELINE_I_GET_FD_HANDLER          "handle-get-pipeline-fd"
 #define DBUS_PIPELINE_I_DELETE_HANDLER          "handle-delete-pipeline"
 
 #define DBUS_PIPELINE_I_LAUNCH_HANDLER          "handle-launch-pipeline"
+#define DBUS_PIPELINE_I_PREWARM_HANDLER         "handle-prewarm-pipeline"
 #define DBUS_PIPELINE_I_START_HANDLER           "handle-start-pipeline"
 #define DBUS_PIPELINE_I_STOP_HANDLER            "handle-stop-pipeline"
 #define DBUS_PIPELINE_I_DESTROY_HANDLER         "handle-destroy-pipeline"
@@ -41,11 +43,14 @@
 #define DBUS_MODEL_PATH                 "/Org/Tizen/MachineLearning/Service/Model"
 
 #define DBUS_MODEL_I_HANDLER_REGISTER           "handle-register"
+#define DBUS_MODEL_I_HANDLER_REGISTER_MANY      "handle-register-many"
 #define DBUS_MODEL_I_HANDLER_UPDATE_DESCRIPTION "handle-update-description"
 #define DBUS_MODEL_I_HANDLER_ACTIVATE           "handle-activate"
 #define DBUS_MODEL_I_HANDLER_GET                "handle-get"
 #define DBUS_MODEL_I_HANDLER_GET_ACTIVATED      "handle-get-activated"
 #define DBUS_MODEL_I_HANDLER_GET_ALL            "handle-get-all"
+#define DBUS_MODEL_I_HANDLER_GET_ALL_FD         "handle-get-all-fd"
+#define DBUS_MODEL_I_HANDLER_LIST               "handle-list"
 #define DBUS_MODEL_I_HANDLER_DELETE             "handle-delete"
 
 /* Resource Interface */
@@ -53,7 +58,14 @@
 #define DBUS_RESOURCE_PATH              "/Org/Tizen/MachineLearning/Service/Resource"
 
 #define DBUS_RESOURCE_I_HANDLER_ADD                "handle-add"
+#define DBUS_RESOURCE_I_HANDLER_ADD_MANY           "handle-add-many"
 #define DBUS_RESOURCE_I_HANDLER_GET                "handle-get"
 #define DBUS_RESOURCE_I_HANDLER_DELETE             "handle-delete"
 
+/* Metrics Interface */
+#define DBUS_METRICS_INTERFACE          "org.tizen.machinelearning.service.metrics"
+#define DBUS_METRICS_PATH               "/Org/Tizen/MachineLearning/Service/Metrics"
+
+#define DBUS_METRICS_I_HANDLER_GET_METRICS         "handle-get-metrics"
+
 #endif /* __GDBUS_INTERFACE_H__ */
@@ -0,0 +1,269 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file    event-util.c
+ * @date    27 Aug 2026
+ * @brief   Shared-memory change-event channel of Machine Learning agent daemon
+ * @see     https://github.com/nnstreamer/deviceMLOps.MLAgent
+ * @author  Sangjung Woo <sangjung.woo@samsung.com>
+ * @bug     No known bugs except for NYI items
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "event-util.h"
+#include "log.h"
+
+/**
+ * @brief The default name of the shared-memory ring. It can be overridden
+ * with the ML_AGENT_EVENT_SHM environment variable, e.g. for tests.
+ */
+#define ML_EVENT_SHM_NAME "/mlops-agent-events"
+
+/**
+ * @brief The number of event slots in the ring. Must be a power of two.
+ */
+#define ML_EVENT_SLOTS (64U)
+
+/**
+ * @brief The magic number of the ring segment ('M' 'L' 'E' 'V').
+ */
+#define ML_EVENT_MAGIC (0x4d4c4556U)
+
+/**
+ * @brief The format version of the ring segment.
+ */
+#define ML_EVENT_FORMAT_VERSION (1U)
+
+/**
+ * @brief One slot of the shared-memory ring.
+ * @details The writer invalidates seq, fills the payload and then stores
+ * the new sequence number, so a reader can detect a torn read by
+ * re-checking seq after copying the payload.
+ */
+struct ml_event_slot
+{
+  guint32 seq;     /**< the 1-based sequence number, 0 while being written */
+  guint32 type;    /**< the ml_event_type_e of the event */
+  gint64 id;       /**< the pipeline id */
+  gint32 state;    /**< the new pipeline state */
+  guint32 version; /**< the activated model version */
+  gchar name[ML_EVENT_NAME_MAX]; /**< the service or model name */
+};
+
+/**
+ * @brief The header and the slots of the shared-memory ring.
+ */
+struct ml_event_shm
+{
+  guint32 magic;    /**< ML_EVENT_MAGIC */
+  guint32 version;  /**< ML_EVENT_FORMAT_VERSION */
+  guint32 head;     /**< the number of events ever published */
+  guint32 reserved; /**< reserved, written as zero */
+  struct ml_event_slot slots[ML_EVENT_SLOTS]; /**< the event slots */
+};
+
+static struct ml_event_shm *g_event_shm = NULL;
+static gboolean g_event_is_publisher = FALSE;
+G_LOCK_DEFINE_STATIC (event_pub);
+
+/**
+ * @brief Get the name of the shared-memory ring.
+ */
+static const gchar *
+ml_event_shm_name (void)
+{
+  const gchar *env = g_getenv ("ML_AGENT_EVENT_SHM");
+
+  return (env && env[0] == '/') ? env : ML_EVENT_SHM_NAME;
+}
+
+/**
+ * @brief Create and map the shared-memory ring. Called by the daemon.
+ */
+gint
+ml_event_pub_init (void)
+{
+  const gchar *name = ml_event_shm_name ();
+  gpointer addr;
+  gint fd;
+
+  if (g_event_shm)
+    return 0;
+
+  fd = shm_open (name, O_CREAT | O_RDWR, 0644);
+  if (fd < 0) {
+    ml_logw ("Failed to create the event segment '%s' (%d).", name, errno);
+    return -errno;
+  }
+
+  if (ftruncate (fd, sizeof (struct ml_event_shm)) != 0) {
+    ml_logw ("Failed to size the event segment '%s' (%d).", name, errno);
+    close (fd);
+    shm_unlink (name);
+    return -EIO;
+  }
+
+  addr = mmap (NULL, sizeof (struct ml_event_shm), PROT_READ | PROT_WRITE,
+      MAP_SHARED, fd, 0);
+  close (fd);
+  if (addr == MAP_FAILED) {
+    ml_logw ("Failed to map the event segment '%s' (%d).", name, errno);
+    shm_unlink (name);
+    return -EIO;
+  }
+
+  memset (addr, 0, sizeof (struct ml_event_shm));
+  g_event_shm = (struct ml_event_shm *) addr;
+  g_event_shm->version = ML_EVENT_FORMAT_VERSION;
+  /* The magic goes last, a reader mapping early sees an unready segment. */
+  g_atomic_int_set ((gint *) &g_event_shm->magic, (gint) ML_EVENT_MAGIC);
+  g_event_is_publisher = TRUE;
+
+  return 0;
+}
+
+/**
+ * @brief Unmap and unlink the shared-memory ring. Called by the daemon.
+ */
+void
+ml_event_pub_finalize (void)
+{
+  if (!g_event_shm || !g_event_is_publisher)
+    return;
+
+  munmap (g_event_shm, sizeof (struct ml_event_shm));
+  g_event_shm = NULL;
+  g_event_is_publisher = FALSE;
+  shm_unlink (ml_event_shm_name ());
+}
+
+/**
+ * @brief Publish one change event into the ring.
+ */
+void
+ml_event_publish (ml_event_type_e type, gint64 id, gint state,
+    guint version, const gchar *name)
+{
+  struct ml_event_slot *slot;
+  guint32 head;
+
+  if (!g_event_shm || !g_event_is_publisher)
+    return;
+
+  /**
+   * Serialize the publishers. The pipeline bus watch publishes from the
+   * main loop while the model handlers publish from the dispatch workers,
+   * so an unserialized read-modify-write of head could hand the same slot
+   * and sequence number to two publishers at once.
+   */
+  G_LOCK (event_pub);
+
+  head = (guint32) g_atomic_int_get ((gint *) &g_event_shm->head);
+  slot = &g_event_shm->slots[head & (ML_EVENT_SLOTS - 1)];
+
+  g_atomic_int_set ((gint *) &slot->seq, 0);
+  slot->type = (guint32) type;
+  slot->id = id;
+  slot->state = (gint32) state;
+  slot->version = (guint32) version;
+  g_strlcpy (slot->name, name ? name : "", ML_EVENT_NAME_MAX);
+  g_atomic_int_set ((gint *) &slot->seq, (gint) (head + 1U));
+
+  g_atomic_int_set ((gint *) &g_event_shm->head, (gint) (head + 1U));
+
+  G_UNLOCK (event_pub);
+}
+
+/**
+ * @brief Map the ring read-only and position the cursor after the newest event.
+ */
+gint
+ml_event_sub_open (guint32 *cursor)
+{
+  const gchar *name = ml_event_shm_name ();
+  gpointer addr;
+  gint fd;
+
+  if (!cursor)
+    return -EINVAL;
+
+  if (!g_event_shm) {
+    fd = shm_open (name, O_RDONLY, 0);
+    if (fd < 0)
+      return -ENOENT;
+
+    addr = mmap (NULL, sizeof (struct ml_event_shm), PROT_READ, MAP_SHARED, fd, 0);
+    close (fd);
+    if (addr == MAP_FAILED)
+      return -ENOENT;
+
+    if (((struct ml_event_shm *) addr)->magic != ML_EVENT_MAGIC) {
+      munmap (addr, sizeof (struct ml_event_shm));
+      return -ENOENT;
+    }
+
+    g_event_shm = (struct ml_event_shm *) addr;
+  }
+
+  *cursor = (guint32) g_atomic_int_get ((gint *) &g_event_shm->head);
+  return 0;
+}
+
+/**
+ * @brief Unmap the ring mapped with ml_event_sub_open().
+ */
+void
+ml_event_sub_close (void)
+{
+  if (!g_event_shm || g_event_is_publisher)
+    return;
+
+  munmap (g_event_shm, sizeof (struct ml_event_shm));
+  g_event_shm = NULL;
+}
+
+/**
+ * @brief Read the next event at the cursor, advancing it.
+ */
+gint
+ml_event_sub_read (guint32 *cursor, ml_event_s *event)
+{
+  struct ml_event_slot *slot;
+  guint32 head, seq;
+
+  if (!cursor || !event || !g_event_shm)
+    return -EINVAL;
+
+  for (;;) {
+    head = (guint32) g_atomic_int_get ((gint *) &g_event_shm->head);
+    if (*cursor == head)
+      return -EAGAIN;
+
+    /* The writer lapped this reader, skip to the oldest retained event. */
+    if (head - *cursor > ML_EVENT_SLOTS)
+      *cursor = head - ML_EVENT_SLOTS;
+
+    slot = &g_event_shm->slots[*cursor & (ML_EVENT_SLOTS - 1)];
+    seq = (guint32) g_atomic_int_get ((gint *) &slot->seq);
+
+    event->type = (ml_event_type_e) slot->type;
+    event->id = slot->id;
+    event->state = (gint) slot->state;
+    event->version = (guint) slot->version;
+    g_strlcpy (event->name, slot->name, ML_EVENT_NAME_MAX);
+
+    (*cursor)++;
+
+    /* Unless overwritten while copying, the event is consistent. */
+    if (seq == *cursor
+        && (guint32) g_atomic_int_get ((gint *) &slot->seq) == *cursor)
+      return 0;
+  }
+}
@@ -0,0 +1,103 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * NNStreamer API / Machine Learning Agent Daemon
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ */
+
+/**
+ * @file    event-util.h
+ * @date    27 Aug 2026
+ * @brief   Shared-memory change-event channel of Machine Learning agent daemon
+ * @see     https://github.com/nnstreamer/deviceMLOps.MLAgent
+ * @author  Sangjung Woo <sangjung.woo@samsung.com>
+ * @bug     No known bugs except for NYI items
+ *
+ * @details
+ *    The daemon publishes pipeline state transitions and model activation
+ *    events into a small shared-memory ring with a generation counter.
+ *    Subscribers map the ring read-only and pay one read per event
+ *    instead of a D-Bus round trip per poll, so the daemon load is
+ *    independent of the subscriber count. The ring only carries change
+ *    notifications; on an overrun the reader skips ahead and should
+ *    re-query the authoritative state over the regular calls.
+ */
+#ifndef __EVENT_UTIL_H__
+#define __EVENT_UTIL_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/**
+ * @brief The maximum length of the service or model name in an event,
+ * including the terminating null. Longer names are truncated.
+ */
+#define ML_EVENT_NAME_MAX (128)
+
+/**
+ * @brief The type of a published change event.
+ */
+typedef enum {
+  ML_EVENT_PIPELINE_STATE = 0, /**< A launched pipeline changed its state. */
+  ML_EVENT_MODEL_ACTIVATED = 1, /**< A model version was activated. */
+} ml_event_type_e;
+
+/**
+ * @brief One change event read from the shared-memory ring.
+ */
+typedef struct {
+  ml_event_type_e type; /**< the type of the event */
+  gint64 id;            /**< the pipeline id, 0 for model events */
+  gint state;           /**< the new pipeline state (GstState), 0 for model events */
+  guint version;        /**< the activated model version, 0 for pipeline events */
+  gchar name[ML_EVENT_NAME_MAX]; /**< the service or model name */
+} ml_event_s;
+
+/**
+ * @brief Create and map the shared-memory ring. Called by the daemon.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+gint ml_event_pub_init (void);
+
+/**
+ * @brief Unmap and unlink the shared-memory ring. Called by the daemon.
+ */
+void ml_event_pub_finalize (void);
+
+/**
+ * @brief Publish one change event into the ring.
+ * @details This is a no-op until ml_event_pub_init() succeeds. The write
+ * is a few atomic stores, cheap enough for the GStreamer bus callback.
+ * @param type The type of the event.
+ * @param id The pipeline id, 0 for model events.
+ * @param state The new pipeline state, 0 for model events.
+ * @param version The activated model version, 0 for pipeline events.
+ * @param name The service or model name.
+ */
+void ml_event_publish (ml_event_type_e type, gint64 id, gint state,
+    guint version, const gchar *name);
+
+/**
+ * @brief Map the ring read-only and position the cursor after the newest event.
+ * @param cursor The reader cursor to initialize.
+ * @return @c 0 on success. -ENOENT if the daemon has not created the ring.
+ */
+gint ml_event_sub_open (guint32 *cursor);
+
+/**
+ * @brief Unmap the ring mapped with ml_event_sub_open().
+ */
+void ml_event_sub_close (void);
+
+/**
+ * @brief Read the next event at the cursor, advancing it.
+ * @details On an overrun the cursor skips to the oldest retained event and
+ * the dropped events are not replayed.
+ * @param cursor The reader cursor.
+ * @param event The event read from the ring.
+ * @return @c 0 on success. -EAGAIN if no event is pending.
+ */
+gint ml_event_sub_read (guint32 *cursor, ml_event_s *event);
+
+G_END_DECLS
+#endif /* __EVENT_UTIL_H__ */
@@ -10,15 +10,178 @@
  * @bug     No known bugs except for NYI items
  */
 
+/* memfd_create() and the sealing constants are _GNU_SOURCE-gated in glibc. */
+#define _GNU_SOURCE
+
 #include <errno.h>
+#include <fcntl.h>
 #include <stdbool.h>
+#include <string.h>
+#include <sys/mman.h>
 #include <systemd/sd-daemon.h>
+#include <unistd.h>
 
 #include "gdbus-util.h"
 #include "log.h"
 
 static GDBusConnection *g_dbus_sys_conn = NULL;
 
+static GThreadPool *g_dispatch_pool = NULL;
+static GHashTable *g_dispatch_queues = NULL;
+G_LOCK_DEFINE_STATIC (dispatch_lock);
+
+/**
+ * @brief Structure for a task pushed to the dispatch layer.
+ */
+struct gdbus_dispatch_task
+{
+  gdbus_dispatch_func func;
+  gpointer data;
+};
+
+/**
+ * @brief Worker function to drain the serial queue of one key.
+ */
+static void
+gdbus_dispatch_worker (gpointer data, gpointer user_data)
+{
+  gchar *key = (gchar *) data;
+  struct gdbus_dispatch_task *task;
+  GQueue *queue;
+
+  for (;;) {
+    G_LOCK (dispatch_lock);
+    queue = (GQueue *) g_hash_table_lookup (g_dispatch_queues, key);
+    task = queue ? (struct gdbus_dispatch_task *) g_queue_pop_head (queue) : NULL;
+    if (!task) {
+      /* The queue is drained, following tasks of this key spawn a new worker. */
+      g_hash_table_remove (g_dispatch_queues, key);
+      G_UNLOCK (dispatch_lock);
+      break;
+    }
+    G_UNLOCK (dispatch_lock);
+
+    task->func (task->data);
+    g_free (task);
+  }
+
+  g_free (key);
+}
+
+/**
+ * @brief Create the worker pool of the dispatch layer.
+ */
+static void
+gdbus_dispatch_initialize (void)
+{
+  G_LOCK (dispatch_lock);
+  if (!g_dispatch_queues)
+    g_dispatch_queues = g_hash_table_new_full (g_str_hash, g_str_equal,
+        g_free, (GDestroyNotify) g_queue_free);
+
+  if (!g_dispatch_pool) {
+    g_dispatch_pool = g_thread_pool_new (gdbus_dispatch_worker, NULL,
+        (gint) g_get_num_processors (), FALSE, NULL);
+  }
+  G_UNLOCK (dispatch_lock);
+}
+
+/**
+ * @brief Hand a method invocation task to the worker pool.
+ * @details Tasks pushed with the same key run one at a time in push order.
+ */
+int
+gdbus_dispatch_push (const char *key, gdbus_dispatch_func func, gpointer data)
+{
+  struct gdbus_dispatch_task *task;
+  GQueue *queue;
+  gboolean spawn = FALSE;
+
+  if (!key || !func)
+    return -EINVAL;
+
+  if (!g_dispatch_pool)
+    return -ENOSYS;
+
+  task = g_new0 (struct gdbus_dispatch_task, 1);
+  task->func = func;
+  task->data = data;
+
+  G_LOCK (dispatch_lock);
+  queue = (GQueue *) g_hash_table_lookup (g_dispatch_queues, key);
+  if (!queue) {
+    queue = g_queue_new ();
+    g_hash_table_insert (g_dispatch_queues, g_strdup (key), queue);
+    spawn = TRUE;
+  }
+  g_queue_push_tail (queue, task);
+  G_UNLOCK (dispatch_lock);
+
+  if (spawn)
+    g_thread_pool_push (g_dispatch_pool, g_strdup (key), NULL);
+
+  return 0;
+}
+
+/**
+ * @brief Wait for the pending dispatch tasks and release the worker pool.
+ */
+void
+gdbus_dispatch_finalize (void)
+{
+  if (g_dispatch_pool) {
+    g_thread_pool_free (g_dispatch_pool, FALSE, TRUE);
+    g_dispatch_pool = NULL;
+  }
+
+  G_LOCK (dispatch_lock);
+  if (g_dispatch_queues) {
+    g_hash_table_destroy (g_dispatch_queues);
+    g_dispatch_queues = NULL;
+  }
+  G_UNLOCK (dispatch_lock);
+}
+
+/**
+ * @brief Create a sealed memory fd holding the given data.
+ * @details The returned fd is sealed against any further modification, so the
+ * receiver can map it read-only without copying the data through the bus.
+ */
+int
+gdbus_memfd_new (const char *name, const void *data, size_t size)
+{
+  int fd;
+  size_t written = 0;
+  ssize_t len;
+
+  fd = memfd_create (name, MFD_CLOEXEC | MFD_ALLOW_SEALING);
+  if (fd < 0) {
+    ml_loge ("Failed to create memfd '%s': %s", name, strerror (errno));
+    return -errno;
+  }
+
+  while (written < size) {
+    len = write (fd, (const char *) data + written, size - written);
+    if (len < 0) {
+      if (errno == EINTR)
+        continue;
+      ml_loge ("Failed to fill memfd '%s': %s", name, strerror (errno));
+      close (fd);
+      return -errno;
+    }
+    written += (size_t) len;
+  }
+
+  if (fcntl (fd, F_ADD_SEALS,
+          F_SEAL_SHRINK | F_SEAL_GROW | F_SEAL_WRITE | F_SEAL_SEAL) < 0) {
+    ml_loge ("Failed to seal memfd '%s': %s", name, strerror (errno));
+    close (fd);
+    return -errno;
+  }
+
+  return fd;
+}
+
 /**
  * @brief Export the DBus interface at the Object path on the bus connection.
  */
@@ -145,14 +308,11 @@ gdbus_put_system_connection (void)
 
 /**
  * @brief Common function to initialize the DBus module.
+ * @note GStreamer is not initialized here but on the first pipeline launch,
+ * so deployments that never launch a pipeline skip the registry loading.
  */
 void
 gdbus_initialize (void)
 {
-  GError *err = NULL;
-
-  if (!gst_init_check (NULL, NULL, &err))
-    ml_loge ("Failed to initialize GStreamer: %s", (err ? err->message : "Unknown error"));
-
-  g_clear_error (&err);
+  gdbus_dispatch_initialize ();
 }
@@ -20,7 +20,6 @@
 
 #include <glib.h>
 #include <gio/gio.h>
-#include <gst/gst.h>
 #include <stdbool.h>
 
 #ifdef __cplusplus
@@ -38,6 +37,15 @@ struct gdbus_signal_info
   gulong handler_id;    /**< Connected handler ID */
 };
 
+/**
+ * @brief Create a sealed memory fd holding the given data.
+ * @param name The debugging name of the memfd.
+ * @param data The data to fill the memfd with.
+ * @param size The size of the data in bytes.
+ * @return The file descriptor on success. Otherwise a negative error value.
+ */
+int gdbus_memfd_new (const char *name, const void *data, size_t size);
+
 /**
  * @brief Export the DBus interface at the Object path on the bus connection.
  * @param instance The instance of the DBus interface to export.
@@ -90,6 +98,28 @@ void gdbus_put_system_connection (void);
  */
 void gdbus_initialize (void);
 
+/**
+ * @brief Task function to be dispatched on a worker thread.
+ */
+typedef void (*gdbus_dispatch_func) (gpointer data);
+
+/**
+ * @brief Hand a method invocation task to the worker pool.
+ * @details Tasks pushed with the same key run one at a time in push order,
+ * so per-key (e.g., per service-name) handler code needs no extra locking.
+ * Tasks with different keys run concurrently on the pool.
+ * @param key The serialization key of the task.
+ * @param func The task function to run on a worker thread.
+ * @param data Data to pass to the task function.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+int gdbus_dispatch_push (const char *key, gdbus_dispatch_func func, gpointer data);
+
+/**
+ * @brief Wait for the pending dispatch tasks and release the worker pool.
+ */
+void gdbus_dispatch_finalize (void);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -14,8 +14,56 @@
 extern "C" {
 #endif /* __cplusplus */
 
+#include <gio/gio.h>
 #include <glib.h>
 
+/**
+ * @brief An interface exported for enabling the in-process direct mode.
+ * @details In direct mode, the DB-backed calls (pipeline descriptions, models, and resources) open the service DB in this process and skip the daemon round trip entirely. It is meant for builds that do not run the agent daemon; it must not be enabled next to a running daemon. The calls operating on launched pipelines still require the daemon. Setting the ML_AGENT_DIRECT_DB_PATH environment variable enables the mode without a code change.
+ * @param[in] db_path A path to the directory holding the service DB.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_direct_mode_enable (const gchar *db_path);
+
+/**
+ * @brief The type of a change event published by the agent daemon.
+ */
+typedef enum {
+  ML_AGENT_EVENT_PIPELINE_STATE = 0, /**< A launched pipeline changed its state. */
+  ML_AGENT_EVENT_MODEL_ACTIVATED = 1, /**< A model version was activated. */
+} ml_agent_event_e;
+
+/**
+ * @brief One change event delivered to a subscriber callback.
+ */
+typedef struct {
+  ml_agent_event_e type; /**< the type of the event */
+  gint64 id;             /**< the pipeline id, 0 for model events */
+  gint state;            /**< the new pipeline state (GstState), 0 for model events */
+  guint version;         /**< the activated model version, 0 for pipeline events */
+  const gchar *name;     /**< the service or model name, owned by the caller */
+} ml_agent_event_s;
+
+/**
+ * @brief Callback invoked for each change event. It runs in the main context of the thread that subscribed.
+ */
+typedef void (*ml_agent_event_cb) (const ml_agent_event_s *event, gpointer user_data);
+
+/**
+ * @brief An interface exported for subscribing to the change events of the agent daemon.
+ * @details Pipeline state transitions and model activations are read from a shared-memory ring published by the daemon; the D-Bus signals only serve as wakeups, so the daemon load does not grow with the subscriber count. Events may be dropped when the subscriber lags far behind; the callback should then re-query the authoritative state. Only one subscription per process is supported.
+ * @param[in] callback A callback invoked for each change event.
+ * @param[in] user_data The user data passed to the callback.
+ * @return 0 on success, a negative error value if failed. -ENOENT if the daemon is not publishing events.
+ */
+gint ml_agent_subscribe_events (ml_agent_event_cb callback, gpointer user_data);
+
+/**
+ * @brief An interface exported for cancelling the subscription made with ml_agent_subscribe_events().
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_unsubscribe_events (void);
+
 /**
  * @brief An interface exported for setting the description of a pipeline.
  * @param[in] name A name indicating the pipeline whose description would be set.
@@ -52,6 +100,15 @@ gint ml_agent_pipeline_delete (const gchar *name, GError **err);
  */
 gint ml_agent_pipeline_launch (const gchar *name, gint64 *id, GError **err);
 
+/**
+ * @brief An interface exported for pre-parsing the pipeline of the given @a name into the warm pool.
+ * @details The pipeline is parsed and pre-rolled in the paused state ahead of time, so a later launch request returns within the time of a state change. An idle warm pipeline releases its resources after a timeout.
+ * @param[in] name A given name of the pipeline to prepare.
+ * @param[out] err A pointer for error, or NULL.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_pipeline_prewarm (const gchar *name, GError **err);
+
 /**
  * @brief An interface exported for changing the pipeline's state of the given @a id to start.
  * @param[in] id An identifier of the launched pipeline whose state would be changed to start.
@@ -98,6 +155,16 @@ gint ml_agent_pipeline_get_state (const gint64 id, gint *state, GError **err);
  */
 gint ml_agent_model_register(const gchar *name, const gchar *path, const gboolean activate, const gchar *description, const gchar *app_info, guint *version, GError **err);
 
+/**
+ * @brief An interface exported for registering multiple models in a single transaction.
+ * @details All the given models are registered in one DB transaction and one D-Bus round trip. If any of them fails, none of them is registered.
+ * @param[in] models The models to register, a GVariant of type "a(ssbss)", i.e., an array of (name, path, activate, description, app_info).
+ * @param[out] versions A pointer for the versions of the registered models, a GVariant of type "au". It should be released using g_variant_unref().
+ * @param[out] err A pointer for error, or NULL.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_model_register_many (GVariant *models, GVariant **versions, GError **err);
+
 /**
  * @brief An interface exported for updating the description of the model with @a name and @a version.
  * @param[in] name A name indicating the model whose description would be updated.
@@ -148,6 +215,20 @@ gint ml_agent_model_get_activated(const gchar *name, gchar **model_info, GError
  */
 gint ml_agent_model_get_all(const gchar *name, gchar **model_info, GError **err);
 
+/**
+ * @brief An interface exported for listing the registered models page by page.
+ * @details The models are ordered by name and version. An empty @a filter matches every model; otherwise @a filter is an SQL LIKE pattern matched against the model names.
+ * @remarks If the function succeeds, @a model_list should be released using g_free().
+ * @param[in] filter An SQL LIKE pattern to match model names, or an empty string for all models.
+ * @param[in] active_state A filter on the active flag. A negative value matches all, 0 matches inactive, and a positive value matches active models.
+ * @param[in] offset The number of matching models to skip before the page starts.
+ * @param[in] limit The maximum number of models in the page. It should not be 0.
+ * @param[out] model_list A pointer for the JSON array of the models in the page.
+ * @param[out] err A pointer for error, or NULL.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_model_list(const gchar *filter, const gint active_state, const guint offset, const guint limit, gchar **model_list, GError **err);
+
 /**
  * @brief An interface exported for removing the model of @a name and @a version.
  * @details If version is 0, this function removes all registered model of @a name.
@@ -169,6 +250,15 @@ gint ml_agent_model_delete(const gchar *name, const guint version, GError **err)
  */
 gint ml_agent_resource_add (const gchar *name, const gchar *path, const gchar *description, const gchar *app_info, GError **err);
 
+/**
+ * @brief An interface exported for adding multiple resources in a single transaction.
+ * @details All the given resources are added in one DB transaction and one D-Bus round trip. If any of them fails, none of them is added.
+ * @param[in] resources The resources to add, a GVariant of type "a(ssss)", i.e., an array of (name, path, description, app_info).
+ * @param[out] err A pointer for error, or NULL.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_resource_add_many (GVariant *resources, GError **err);
+
 /**
  * @brief An interface exported for removing the resource with @a name.
  * @param[in] name A name indicating the resource.
@@ -187,6 +277,428 @@ gint ml_agent_resource_delete (const gchar *name, GError **err);
  */
 gint ml_agent_resource_get (const gchar *name, gchar **res_info, GError **err);
 
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_set_description(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A name indicating the pipeline whose description would be set.
+ * @param[in] pipeline_desc A stringified description of the pipeline.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_pipeline_set_description_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_pipeline_set_description_async (const gchar *name, const gchar *pipeline_desc, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_pipeline_set_description_async().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_pipeline_set_description_finish (GAsyncResult *result, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_get_description(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A given name of the pipeline to get the description.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_pipeline_get_description_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_pipeline_get_description_async (const gchar *name, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_pipeline_get_description_async().
+ * @param[out] pipeline_desc A stringified description of the pipeline. It should be released using g_free().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_pipeline_get_description_finish (GAsyncResult *result, gchar **pipeline_desc, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_delete(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A given name of the pipeline to remove the description.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_pipeline_delete_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_pipeline_delete_async (const gchar *name, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_pipeline_delete_async().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_pipeline_delete_finish (GAsyncResult *result, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_launch(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A given name of the pipeline to launch.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_pipeline_launch_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_pipeline_launch_async (const gchar *name, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_pipeline_launch_async().
+ * @param[out] id A pointer of integer identifier for the launched pipeline.
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_pipeline_launch_finish (GAsyncResult *result, gint64 * id, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_prewarm(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A given name of the pipeline to prepare.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_pipeline_prewarm_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_pipeline_prewarm_async (const gchar *name, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_pipeline_prewarm_async().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_pipeline_prewarm_finish (GAsyncResult *result, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_start(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] id An identifier of the launched pipeline whose state would be changed to start.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_pipeline_start_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_pipeline_start_async (const gint64 id, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_pipeline_start_async().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_pipeline_start_finish (GAsyncResult *result, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_stop(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] id An identifier of the launched pipeline whose state would be changed to stop.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_pipeline_stop_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_pipeline_stop_async (const gint64 id, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_pipeline_stop_async().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_pipeline_stop_finish (GAsyncResult *result, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_destroy(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] id An identifier of the launched pipeline to destroy.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_pipeline_destroy_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_pipeline_destroy_async (const gint64 id, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_pipeline_destroy_async().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_pipeline_destroy_finish (GAsyncResult *result, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_get_state(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] id An identifier of the launched pipeline to get the state.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_pipeline_get_state_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_pipeline_get_state_async (const gint64 id, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_pipeline_get_state_async().
+ * @param[out] state A pointer for the pipeline's state.
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_pipeline_get_state_finish (GAsyncResult *result, gint * state, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_register(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A name indicating the model.
+ * @param[in] path A path of the model file.
+ * @param[in] activate An initial activation state.
+ * @param[in] description A description of the model.
+ * @param[in] app_info Application-specific information from Tizen's RPK.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_model_register_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_model_register_async (const gchar *name, const gchar *path, const gboolean activate, const gchar *description, const gchar *app_info, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_model_register_async().
+ * @param[out] version A pointer for the version of the registered model.
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_model_register_finish (GAsyncResult *result, guint * version, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_register_many(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] models The models to register, a GVariant of type "a(ssbss)".
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_model_register_many_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_model_register_many_async (GVariant *models, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_model_register_many_async().
+ * @param[out] versions A pointer for the versions of the registered models. It should be released using g_variant_unref().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_model_register_many_finish (GAsyncResult *result, GVariant **versions, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_update_description(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A name indicating the model.
+ * @param[in] version A version for identifying the model.
+ * @param[in] description A new description of the model.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_model_update_description_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_model_update_description_async (const gchar *name, const guint version, const gchar *description, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_model_update_description_async().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_model_update_description_finish (GAsyncResult *result, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_activate(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A name indicating the model.
+ * @param[in] version A version of the model to activate.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_model_activate_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_model_activate_async (const gchar *name, const guint version, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_model_activate_async().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_model_activate_finish (GAsyncResult *result, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_get(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A name indicating the model.
+ * @param[in] version A version of the model.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_model_get_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_model_get_async (const gchar *name, const guint version, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_model_get_async().
+ * @param[out] model_info A pointer for the information of the model. It should be released using g_free().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_model_get_finish (GAsyncResult *result, gchar **model_info, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_get_activated(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A name indicating the model.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_model_get_activated_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_model_get_activated_async (const gchar *name, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_model_get_activated_async().
+ * @param[out] model_info A pointer for the information of the activated model. It should be released using g_free().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_model_get_activated_finish (GAsyncResult *result, gchar **model_info, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_get_all(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A name indicating the models.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_model_get_all_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_model_get_all_async (const gchar *name, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_model_get_all_async().
+ * @param[out] model_info A pointer for the information of all the models. It should be released using g_free().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_model_get_all_finish (GAsyncResult *result, gchar **model_info, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_list(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] filter An SQL LIKE pattern to match model names, or an empty string for all models.
+ * @param[in] active_state A filter on the active flag. A negative value matches all.
+ * @param[in] offset The number of matching models to skip before the page starts.
+ * @param[in] limit The maximum number of models in the page.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_model_list_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_model_list_async (const gchar *filter, const gint active_state, const guint offset, const guint limit, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_model_list_async().
+ * @param[out] model_list A pointer for the JSON array of the models in the page. It should be released using g_free().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_model_list_finish (GAsyncResult *result, gchar **model_list, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_delete(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A name indicating the model.
+ * @param[in] version A version of the model to remove. 0 removes all versions.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_model_delete_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_model_delete_async (const gchar *name, const guint version, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_model_delete_async().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_model_delete_finish (GAsyncResult *result, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_resource_add(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A name indicating the resource.
+ * @param[in] path A path of the resource.
+ * @param[in] description A description of the resource.
+ * @param[in] app_info Application-specific information from Tizen's RPK.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_resource_add_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_resource_add_async (const gchar *name, const gchar *path, const gchar *description, const gchar *app_info, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_resource_add_async().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_resource_add_finish (GAsyncResult *result, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_resource_add_many(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] resources The resources to add, a GVariant of type "a(ssss)".
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_resource_add_many_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_resource_add_many_async (GVariant *resources, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_resource_add_many_async().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_resource_add_many_finish (GAsyncResult *result, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_resource_delete(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A name indicating the resource.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_resource_delete_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_resource_delete_async (const gchar *name, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_resource_delete_async().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_resource_delete_finish (GAsyncResult *result, GError **err);
+
+/**
+ * @brief An asynchronous variant of ml_agent_resource_get(). It never blocks the caller; the call runs in the background and @a callback is invoked when it completes.
+ * @param[in] name A name indicating the resource.
+ * @param[in] cancellable A GCancellable to cancel the call, or NULL.
+ * @param[in] callback A callback invoked when the call completes. Call ml_agent_resource_get_finish() from it.
+ * @param[in] user_data User data passed to @a callback.
+ * @return 0 if the call was queued, a negative error value if failed.
+ */
+gint ml_agent_resource_get_async (const gchar *name, GCancellable *cancellable, GAsyncReadyCallback callback, gpointer user_data);
+
+/**
+ * @brief Get the result of ml_agent_resource_get_async().
+ * @param[out] res_info A pointer for the information of the resource. It should be released using g_free().
+ * @param[in] result The GAsyncResult handed to the callback.
+ * @param[out] err A pointer for error, or NULL. A cancelled call sets it and returns -ECANCELED.
+ * @return 0 on success, a negative error value if failed.
+ */
+gint ml_agent_resource_get_finish (GAsyncResult *result, gchar **res_info, GError **err);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -0,0 +1,220 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file    log-util.c
+ * @date    27 Aug 2026
+ * @brief   Internal asynchronous log backend of Machine Learning agent daemon
+ * @see     https://github.com/nnstreamer/deviceMLOps.MLAgent
+ * @author  Sangjung Woo <sangjung.woo@samsung.com>
+ * @bug     No known bugs except for NYI items
+ */
+
+#include <stdarg.h>
+#include <string.h>
+
+#include "log-util.h"
+#include "log.h"
+
+/**
+ * @brief The number of ring buffer slots. Must be a power of two.
+ */
+#define ML_LOG_RING_SIZE (1024U)
+
+/**
+ * @brief The maximum length of one formatted message including the
+ * terminating null. Longer messages are truncated.
+ */
+#define ML_LOG_MSG_MAX (256)
+
+/**
+ * @brief The sleep interval of the drain thread when the ring is empty,
+ * in microseconds.
+ */
+#define ML_LOG_DRAIN_IDLE_US (10000)
+
+/**
+ * @brief Structure for one ring buffer slot.
+ */
+struct ml_log_slot
+{
+  gint ready;   /**< nonzero after the writer finished filling the slot */
+  gint level;   /**< the log level of the message */
+  gchar msg[ML_LOG_MSG_MAX]; /**< the formatted message */
+};
+
+gint g_ml_log_async_active = 0;
+
+static struct ml_log_slot g_log_ring[ML_LOG_RING_SIZE];
+static gint g_log_head = 0;
+static gint g_log_tail = 0;
+static gint g_log_dropped = 0;
+static gint g_log_running = 0;
+static GThread *g_log_thread = NULL;
+
+/**
+ * @brief Emit one message synchronously to the underlying logger.
+ */
+static void
+ml_log_emit (gint level, const gchar *msg)
+{
+#if defined(__TIZEN__)
+  log_priority prio;
+
+  switch (level) {
+    case ML_LOG_DEBUG:
+      prio = DLOG_DEBUG;
+      break;
+    case ML_LOG_INFO:
+      prio = DLOG_INFO;
+      break;
+    case ML_LOG_WARN:
+      prio = DLOG_WARN;
+      break;
+    default:
+      prio = DLOG_ERROR;
+      break;
+  }
+
+  dlog_print (prio, AGENT_LOG_TAG, "%s", msg);
+#else
+  GLogLevelFlags flags;
+
+  switch (level) {
+    case ML_LOG_DEBUG:
+      flags = G_LOG_LEVEL_DEBUG;
+      break;
+    case ML_LOG_INFO:
+      flags = G_LOG_LEVEL_INFO;
+      break;
+    case ML_LOG_WARN:
+      flags = G_LOG_LEVEL_WARNING;
+      break;
+    default:
+      flags = G_LOG_LEVEL_CRITICAL;
+      break;
+  }
+
+  g_log (G_LOG_DOMAIN, flags, "%s", msg);
+#endif
+}
+
+/**
+ * @brief Emit the slots between tail and head, in order.
+ * @return The number of emitted messages.
+ */
+static guint
+ml_log_drain_once (void)
+{
+  struct ml_log_slot *slot;
+  guint emitted = 0;
+  gint tail;
+
+  while ((tail = g_atomic_int_get (&g_log_tail)) != g_atomic_int_get (&g_log_head)) {
+    slot = &g_log_ring[(guint) tail & (ML_LOG_RING_SIZE - 1)];
+
+    /* The writer claimed the slot but has not finished filling it yet. */
+    if (!g_atomic_int_get (&slot->ready))
+      break;
+
+    ml_log_emit (slot->level, slot->msg);
+    g_atomic_int_set (&slot->ready, 0);
+    g_atomic_int_set (&g_log_tail, tail + 1);
+    emitted++;
+  }
+
+  return emitted;
+}
+
+/**
+ * @brief The main function of the drain thread. It emits pending
+ * messages, reports the overload drops and sleeps while idle.
+ */
+static gpointer
+ml_log_drain_thread (gpointer data)
+{
+  gchar *msg;
+  gint dropped;
+
+  while (g_atomic_int_get (&g_log_running)) {
+    if (ml_log_drain_once () == 0)
+      g_usleep (ML_LOG_DRAIN_IDLE_US);
+
+    dropped = g_atomic_int_get (&g_log_dropped);
+    if (dropped > 0) {
+      g_atomic_int_add (&g_log_dropped, -dropped);
+
+      msg = g_strdup_printf (
+          "Log ring buffer overloaded, %d messages dropped.", dropped);
+      ml_log_emit (ML_LOG_WARN, msg);
+      g_free (msg);
+    }
+  }
+
+  /* Flush what is left before exiting. */
+  ml_log_drain_once ();
+  return NULL;
+}
+
+/**
+ * @brief Start the drain thread and activate the asynchronous backend.
+ */
+void
+ml_log_async_init (void)
+{
+  if (g_log_thread)
+    return;
+
+  g_atomic_int_set (&g_log_running, 1);
+  g_log_thread = g_thread_new ("ml-log-drain", ml_log_drain_thread, NULL);
+  g_atomic_int_set (&g_ml_log_async_active, 1);
+}
+
+/**
+ * @brief Deactivate the asynchronous backend and flush the ring buffer.
+ */
+void
+ml_log_async_finalize (void)
+{
+  if (!g_log_thread)
+    return;
+
+  /* New messages go back to synchronous emission first. */
+  g_atomic_int_set (&g_ml_log_async_active, 0);
+  g_atomic_int_set (&g_log_running, 0);
+  g_thread_join (g_log_thread);
+  g_log_thread = NULL;
+}
+
+/**
+ * @brief Append one message to the ring buffer, dropping it when full.
+ */
+void
+ml_log_async_write (ml_log_level_e level, const gchar *func, const gint line,
+    const gchar *fmt, ...)
+{
+  struct ml_log_slot *slot;
+  gchar formatted[ML_LOG_MSG_MAX];
+  va_list args;
+  gint head;
+  gsize len;
+
+  va_start (args, fmt);
+  len = (gsize) g_snprintf (formatted, sizeof (formatted), "%s(%d) > ", func, line);
+  if (len < sizeof (formatted))
+    g_vsnprintf (formatted + len, sizeof (formatted) - len, fmt, args);
+  va_end (args);
+
+  do {
+    head = g_atomic_int_get (&g_log_head);
+    if ((guint) (head - g_atomic_int_get (&g_log_tail)) >= ML_LOG_RING_SIZE) {
+      g_atomic_int_inc (&g_log_dropped);
+      return;
+    }
+  } while (!g_atomic_int_compare_and_exchange (&g_log_head, head, head + 1));
+
+  slot = &g_log_ring[(guint) head & (ML_LOG_RING_SIZE - 1)];
+  slot->level = level;
+  memcpy (slot->msg, formatted, sizeof (formatted));
+  g_atomic_int_set (&slot->ready, 1);
+}
@@ -0,0 +1,78 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * NNStreamer API / Machine Learning Agent Daemon
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ */
+
+/**
+ * @file    log-util.h
+ * @date    27 Aug 2026
+ * @brief   Internal asynchronous log backend of Machine Learning agent daemon
+ * @see     https://github.com/nnstreamer/deviceMLOps.MLAgent
+ * @author  Sangjung Woo <sangjung.woo@samsung.com>
+ * @bug     No known bugs except for NYI items
+ *
+ * @details
+ *    This decouples log emission from the hot paths. When the backend is
+ *    enabled, the ml_log macros append the formatted message to a ring
+ *    buffer with atomic operations and a drain thread emits it to the
+ *    underlying logger. Messages arriving while the ring is full are
+ *    dropped and accounted, so a fault storm cannot inflate the latency
+ *    of the handler that logs it.
+ */
+#ifndef __LOG_UTIL_H__
+#define __LOG_UTIL_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/**
+ * @brief Log levels of the asynchronous backend, mapped to the
+ * underlying logger on emission.
+ */
+typedef enum {
+  ML_LOG_DEBUG = 0,
+  ML_LOG_INFO,
+  ML_LOG_WARN,
+  ML_LOG_ERROR,
+} ml_log_level_e;
+
+/**
+ * @brief Nonzero while the asynchronous backend is active. Do not touch
+ * this directly, use ml_log_async_enabled().
+ */
+extern gint g_ml_log_async_active;
+
+/**
+ * @brief Check whether the asynchronous backend is active.
+ */
+#define ml_log_async_enabled() (g_atomic_int_get (&g_ml_log_async_active) != 0)
+
+/**
+ * @brief Start the drain thread and route the ml_log macros through the
+ * ring buffer. Until this is called, all macros emit synchronously.
+ */
+void ml_log_async_init (void);
+
+/**
+ * @brief Flush the remaining messages, stop the drain thread and fall
+ * back to synchronous emission.
+ */
+void ml_log_async_finalize (void);
+
+/**
+ * @brief Append one message to the ring buffer.
+ * @details The message is formatted in the calling thread and emitted
+ * later by the drain thread. If the ring is full the message is dropped
+ * and the drain thread reports the number of dropped messages.
+ * @param level The log level of the message.
+ * @param func The name of the logging function.
+ * @param line The line number of the log statement.
+ * @param fmt The printf-style format string.
+ */
+void ml_log_async_write (ml_log_level_e level, const gchar *func,
+    const gint line, const gchar *fmt, ...) G_GNUC_PRINTF (4, 5);
+
+G_END_DECLS
+#endif /* __LOG_UTIL_H__ */
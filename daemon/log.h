@@ -18,6 +18,8 @@
 #ifndef __LOG_H__
 #define __LOG_H__
 
+#include "log-util.h"
+
 #if defined(__TIZEN__)
 #include <dlog.h>
 
@@ -28,18 +30,44 @@
     dlog_print(prio, tag, "%s: %s(%d) > " fmt, __MODULE__, __func__, __LINE__, ##arg);\
   } while (0); })
 
-#define ml_logd(fmt, arg...) LOG_V(DLOG_DEBUG, AGENT_LOG_TAG, fmt, ##arg)
-#define ml_logi(fmt, arg...) LOG_V(DLOG_INFO, AGENT_LOG_TAG, fmt, ##arg)
-#define ml_logw(fmt, arg...) LOG_V(DLOG_WARN, AGENT_LOG_TAG, fmt, ##arg)
-#define ml_loge(fmt, arg...) LOG_V(DLOG_ERROR, AGENT_LOG_TAG, fmt, ##arg)
+/**
+ * @brief Route the message through the asynchronous backend when it is
+ * active, emit it synchronously otherwise.
+ */
+#define ML_LOG_V(level, prio, fmt, arg...) \
+  do { \
+    if (ml_log_async_enabled ()) \
+      ml_log_async_write (level, __func__, __LINE__, fmt, ##arg); \
+    else \
+      LOG_V (prio, AGENT_LOG_TAG, fmt, ##arg); \
+  } while (0)
+
+#define ml_logd(fmt, arg...) ML_LOG_V(ML_LOG_DEBUG, DLOG_DEBUG, fmt, ##arg)
+#define ml_logi(fmt, arg...) ML_LOG_V(ML_LOG_INFO, DLOG_INFO, fmt, ##arg)
+#define ml_logw(fmt, arg...) ML_LOG_V(ML_LOG_WARN, DLOG_WARN, fmt, ##arg)
+#define ml_loge(fmt, arg...) ML_LOG_V(ML_LOG_ERROR, DLOG_ERROR, fmt, ##arg)
+/* Fatal aborts the daemon, it always emits synchronously. */
 #define ml_logf(fmt, arg...) LOG_V(DLOG_FATAL, AGENT_LOG_TAG, fmt, ##arg)
 #else
 #include <glib.h>
 
-#define ml_logd g_debug
-#define ml_logi g_info
-#define ml_logw g_warning
-#define ml_loge g_critical
+/**
+ * @brief Route the message through the asynchronous backend when it is
+ * active, emit it synchronously otherwise.
+ */
+#define ML_LOG_V(level, sync_log, fmt, arg...) \
+  do { \
+    if (ml_log_async_enabled ()) \
+      ml_log_async_write (level, __func__, __LINE__, fmt, ##arg); \
+    else \
+      sync_log (fmt, ##arg); \
+  } while (0)
+
+#define ml_logd(fmt, arg...) ML_LOG_V(ML_LOG_DEBUG, g_debug, fmt, ##arg)
+#define ml_logi(fmt, arg...) ML_LOG_V(ML_LOG_INFO, g_info, fmt, ##arg)
+#define ml_logw(fmt, arg...) ML_LOG_V(ML_LOG_WARN, g_warning, fmt, ##arg)
+#define ml_loge(fmt, arg...) ML_LOG_V(ML_LOG_ERROR, g_critical, fmt, ##arg)
+/* Fatal aborts the daemon, it always emits synchronously. */
 #define ml_logf g_error
 #endif
 
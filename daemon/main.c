@@ -18,6 +18,7 @@
 
 #include "common.h"
 #include "modules.h"
+#include "event-util.h"
 #include "gdbus-util.h"
 #include "log.h"
 #include "dbus-interface.h"
@@ -28,6 +29,8 @@ static GMainLoop *g_mainloop = NULL;
 static gboolean verbose = FALSE;
 static gboolean is_session = FALSE;
 static gchar *db_path = NULL;
+static gchar *storage_mode = NULL;
+static gchar *db_config = NULL;
 
 /**
  * @brief Handle the SIGTERM signal and quit the main loop
@@ -73,6 +76,10 @@ parse_args (gint *argc, gchar ***argv)
     { "verbose", 'v', 0, G_OPTION_ARG_NONE, &verbose, "Be verbose", NULL },
     { "session", 's', 0, G_OPTION_ARG_NONE, &is_session, "Bus type is session", NULL },
     { "path", 'p', 0, G_OPTION_ARG_STRING, &db_path, "Path to database", NULL },
+    { "storage-mode", 'm', 0, G_OPTION_ARG_STRING, &storage_mode,
+        "Storage mode of database (default|wal|wal-relaxed)", NULL },
+    { "db-config", 'c', 0, G_OPTION_ARG_STRING, &db_config,
+        "Path to storage configuration file of database", NULL },
     { NULL }
   };
 
@@ -110,11 +117,33 @@ main (int argc, char **argv)
     goto error;
   }
 
+  /* Keep synchronous log emission for debugging with the verbose option. */
+  if (!verbose)
+    ml_log_async_init ();
+
+  /* storage mode of database */
+  if (storage_mode) {
+    if (g_ascii_strcasecmp (storage_mode, "wal") == 0)
+      svcdb_set_storage_mode (SVCDB_STORAGE_WAL);
+    else if (g_ascii_strcasecmp (storage_mode, "wal-relaxed") == 0)
+      svcdb_set_storage_mode (SVCDB_STORAGE_WAL_RELAXED);
+    else if (g_ascii_strcasecmp (storage_mode, "default") != 0)
+      ml_logw ("Unknown storage mode '%s', use default mode.", storage_mode);
+  }
+
+  /* storage configuration of database */
+  if (db_config)
+    svcdb_set_config_file (db_config);
+
   /* path to database */
   if (!db_path)
     db_path = g_strdup (DB_PATH);
   svcdb_initialize (db_path);
 
+  /* Open the shared-memory change-event channel for subscribers. */
+  if (ml_event_pub_init () < 0)
+    ml_logw ("cannot init the change-event channel");
+
   g_mainloop = g_main_loop_new (NULL, FALSE);
   gdbus_get_system_connection (is_session);
 
@@ -128,6 +157,8 @@ main (int argc, char **argv)
   }
 
   g_main_loop_run (g_mainloop);
+
+  gdbus_dispatch_finalize ();
   exit_modules (NULL);
 
   gdbus_put_system_connection ();
@@ -139,9 +170,15 @@ main (int argc, char **argv)
 
 error:
   svcdb_finalize ();
+  ml_event_pub_finalize ();
+  ml_log_async_finalize ();
 
   is_session = verbose = FALSE;
   g_free (db_path);
   db_path = NULL;
+  g_free (storage_mode);
+  storage_mode = NULL;
+  g_free (db_config);
+  db_config = NULL;
   return ret;
 }
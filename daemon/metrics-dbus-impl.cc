@@ -0,0 +1,145 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file    metrics-dbus-impl.cc
+ * @date    27 Aug 2026
+ * @brief   DBus implementation for Metrics Interface
+ * @see     https://github.com/nnstreamer/deviceMLOps.MLAgent
+ * @author  Sangjung Woo <sangjung.woo@samsung.com>
+ * @bug     No known bugs except for NYI items
+ */
+
+#include <errno.h>
+#include <glib.h>
+
+#include "common.h"
+#include "dbus-interface.h"
+#include "gdbus-util.h"
+#include "log.h"
+#include "metrics-dbus.h"
+#include "metrics-util.h"
+#include "modules.h"
+
+static MachinelearningServiceMetrics *g_gdbus_metrics_instance = NULL;
+
+/**
+ * @brief Utility function to get the DBus proxy.
+ */
+static MachinelearningServiceMetrics *
+gdbus_get_metrics_instance (void)
+{
+  return machinelearning_service_metrics_skeleton_new ();
+}
+
+/**
+ * @brief Utility function to release DBus proxy.
+ */
+static void
+gdbus_put_metrics_instance (MachinelearningServiceMetrics **instance)
+{
+  g_clear_object (instance);
+}
+
+/**
+ * @brief The callback function of GetMetrics method
+ * @param obj Proxy instance.
+ * @param invoc Method invocation handle.
+ * @return @c TRUE if the request is handled. FALSE if the service is not available.
+ */
+static gboolean
+gdbus_cb_metrics_get_metrics (MachinelearningServiceMetrics *obj,
+    GDBusMethodInvocation *invoc)
+{
+  g_autofree gchar *metrics = NULL;
+
+  metrics = ml_metrics_report ();
+  machinelearning_service_metrics_complete_get_metrics (obj, invoc, metrics, 0);
+
+  return TRUE;
+}
+
+/**
+ * @brief Event handler list of metrics interface
+ */
+static struct gdbus_signal_info metrics_handler_infos[] = {
+  {
+      .signal_name = DBUS_METRICS_I_HANDLER_GET_METRICS,
+      .cb = G_CALLBACK (gdbus_cb_metrics_get_metrics),
+      .cb_data = NULL,
+      .handler_id = 0,
+  },
+};
+
+/**
+ * @brief The callback function for probing metrics Interface module.
+ */
+static int
+probe_metrics_module (void *data)
+{
+  int ret = 0;
+
+  ml_logd ("probe_metrics_module");
+
+  g_gdbus_metrics_instance = gdbus_get_metrics_instance ();
+  if (NULL == g_gdbus_metrics_instance) {
+    ml_loge ("cannot get a dbus instance for the %s interface\n", DBUS_METRICS_INTERFACE);
+    return -ENOSYS;
+  }
+
+  ret = gdbus_connect_signal (g_gdbus_metrics_instance,
+      ARRAY_SIZE (metrics_handler_infos), metrics_handler_infos);
+  if (ret < 0) {
+    ml_loge ("cannot register callbacks as the dbus method invocation handlers\n ret: %d", ret);
+    ret = -ENOSYS;
+    goto out;
+  }
+
+  ret = gdbus_export_interface (g_gdbus_metrics_instance, DBUS_METRICS_PATH);
+  if (ret < 0) {
+    ml_loge ("cannot export the dbus interface '%s' at the object path '%s'\n",
+        DBUS_METRICS_INTERFACE, DBUS_METRICS_PATH);
+    ret = -ENOSYS;
+    goto out_disconnect;
+  }
+
+  return 0;
+
+out_disconnect:
+  gdbus_disconnect_signal (g_gdbus_metrics_instance,
+      ARRAY_SIZE (metrics_handler_infos), metrics_handler_infos);
+
+out:
+  gdbus_put_metrics_instance (&g_gdbus_metrics_instance);
+
+  return ret;
+}
+
+/**
+ * @brief The callback function for initializing metrics interface module.
+ */
+static void
+init_metrics_module (void *data)
+{
+  gdbus_initialize ();
+}
+
+/**
+ * @brief The callback function for exiting metrics interface module.
+ */
+static void
+exit_metrics_module (void *data)
+{
+  gdbus_disconnect_signal (g_gdbus_metrics_instance,
+      ARRAY_SIZE (metrics_handler_infos), metrics_handler_infos);
+  gdbus_put_metrics_instance (&g_gdbus_metrics_instance);
+}
+
+static const struct module_ops metrics_ops = {
+  .name = "metrics-interface",
+  .probe = probe_metrics_module,
+  .init = init_metrics_module,
+  .exit = exit_metrics_module,
+};
+
+MODULE_OPS_REGISTER (&metrics_ops)
@@ -0,0 +1,161 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file    metrics-util.c
+ * @date    27 Aug 2026
+ * @brief   Internal lightweight metrics utility of Machine Learning agent daemon
+ * @see     https://github.com/nnstreamer/deviceMLOps.MLAgent
+ * @author  Sangjung Woo <sangjung.woo@samsung.com>
+ * @bug     No known bugs except for NYI items
+ */
+
+#include <string.h>
+
+#include "metrics-util.h"
+#include "log.h"
+
+/**
+ * @brief The maximum number of metric slots.
+ */
+#define ML_METRICS_MAX_SLOTS (64)
+
+/**
+ * @brief The number of log2 latency buckets. The last bucket collects
+ * everything at or above 2^(ML_METRICS_NUM_BUCKETS - 1) microseconds.
+ */
+#define ML_METRICS_NUM_BUCKETS (24)
+
+/**
+ * @brief Structure for one metric slot.
+ */
+struct ml_metric_slot
+{
+  const gchar *name;    /**< the name of the metric */
+  gint count;           /**< the number of recorded calls */
+  gint max_us;          /**< the largest recorded elapsed time */
+  gint buckets[ML_METRICS_NUM_BUCKETS]; /**< log2 latency histogram */
+};
+
+static struct ml_metric_slot g_metric_slots[ML_METRICS_MAX_SLOTS];
+static gint g_metric_num_slots = 0;
+G_LOCK_DEFINE_STATIC (metrics_lock);
+
+/**
+ * @brief Find the slot of the given name, allocating it on first use.
+ */
+static struct ml_metric_slot *
+ml_metrics_get_slot (const gchar *name)
+{
+  gint i, num;
+
+  /* Slots are append-only, the lock-free scan is safe for existing ones. */
+  num = g_atomic_int_get (&g_metric_num_slots);
+  for (i = 0; i < num; i++) {
+    if (g_str_equal (g_metric_slots[i].name, name))
+      return &g_metric_slots[i];
+  }
+
+  G_LOCK (metrics_lock);
+  num = g_atomic_int_get (&g_metric_num_slots);
+  for (i = 0; i < num; i++) {
+    if (g_str_equal (g_metric_slots[i].name, name)) {
+      G_UNLOCK (metrics_lock);
+      return &g_metric_slots[i];
+    }
+  }
+
+  if (num >= ML_METRICS_MAX_SLOTS) {
+    G_UNLOCK (metrics_lock);
+    ml_logw ("Too many metrics, drop the record of '%s'.", name);
+    return NULL;
+  }
+
+  g_metric_slots[num].name = g_intern_string (name);
+  g_atomic_int_set (&g_metric_num_slots, num + 1);
+  G_UNLOCK (metrics_lock);
+
+  return &g_metric_slots[num];
+}
+
+/**
+ * @brief Record one call of the given metric with its elapsed time.
+ */
+void
+ml_metrics_record (const gchar *name, gint64 elapsed_us)
+{
+  struct ml_metric_slot *slot;
+  gint bucket = 0, max;
+  gint64 value = elapsed_us;
+
+  if (!name)
+    return;
+
+  slot = ml_metrics_get_slot (name);
+  if (!slot)
+    return;
+
+  while (value > 1 && bucket < ML_METRICS_NUM_BUCKETS - 1) {
+    value >>= 1;
+    bucket++;
+  }
+
+  g_atomic_int_inc (&slot->count);
+  g_atomic_int_inc (&slot->buckets[bucket]);
+
+  /* Keep the observed maximum, tolerating a lost race with a larger value. */
+  max = g_atomic_int_get (&slot->max_us);
+  while (elapsed_us > max) {
+    if (g_atomic_int_compare_and_exchange (&slot->max_us, max, (gint) MIN (elapsed_us, G_MAXINT)))
+      break;
+    max = g_atomic_int_get (&slot->max_us);
+  }
+}
+
+/**
+ * @brief Get the upper-bound latency of the bucket holding the given percentile.
+ */
+static gint64
+ml_metrics_percentile (const gint *buckets, gint count, gdouble percentile)
+{
+  gint64 threshold, seen = 0;
+  gint i;
+
+  threshold = (gint64) (count * percentile);
+  for (i = 0; i < ML_METRICS_NUM_BUCKETS; i++) {
+    seen += buckets[i];
+    if (seen > threshold)
+      return ((gint64) 1) << i;
+  }
+
+  return ((gint64) 1) << (ML_METRICS_NUM_BUCKETS - 1);
+}
+
+/**
+ * @brief Get a snapshot of all recorded metrics.
+ */
+gchar *
+ml_metrics_report (void)
+{
+  GString *report = g_string_new (NULL);
+  gint buckets[ML_METRICS_NUM_BUCKETS];
+  gint i, b, num, count;
+
+  num = g_atomic_int_get (&g_metric_num_slots);
+  for (i = 0; i < num; i++) {
+    struct ml_metric_slot *slot = &g_metric_slots[i];
+
+    count = g_atomic_int_get (&slot->count);
+    for (b = 0; b < ML_METRICS_NUM_BUCKETS; b++)
+      buckets[b] = g_atomic_int_get (&slot->buckets[b]);
+
+    g_string_append_printf (report,
+        "%s,count=%d,p50_us=%" G_GINT64_FORMAT ",p99_us=%" G_GINT64_FORMAT ",max_us=%d\n",
+        slot->name, count,
+        count > 0 ? ml_metrics_percentile (buckets, count, 0.50) : 0,
+        count > 0 ? ml_metrics_percentile (buckets, count, 0.99) : 0,
+        g_atomic_int_get (&slot->max_us));
+  }
+
+  return g_string_free (report, FALSE);
+}
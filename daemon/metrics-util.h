@@ -0,0 +1,47 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * NNStreamer API / Machine Learning Agent Daemon
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ */
+
+/**
+ * @file    metrics-util.h
+ * @date    27 Aug 2026
+ * @brief   Internal lightweight metrics utility of Machine Learning agent daemon
+ * @see     https://github.com/nnstreamer/deviceMLOps.MLAgent
+ * @author  Sangjung Woo <sangjung.woo@samsung.com>
+ * @bug     No known bugs except for NYI items
+ *
+ * @details
+ *    This records per-method call counters and latency histograms with
+ *    atomic counters and preallocated buckets, cheap enough to stay
+ *    enabled in production. The snapshot is exported over the Metrics
+ *    D-Bus interface.
+ */
+#ifndef __METRICS_UTIL_H__
+#define __METRICS_UTIL_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/**
+ * @brief Record one call of the given metric with its elapsed time.
+ * @details The metric slot is allocated on first use; recording into an
+ * existing slot is lock-free. The elapsed time is put into a log2 latency
+ * bucket, so percentiles reported later are bucket upper bounds.
+ * @param name The name of the metric.
+ * @param elapsed_us The elapsed time of the call in microseconds.
+ */
+void ml_metrics_record (const gchar *name, gint64 elapsed_us);
+
+/**
+ * @brief Get a snapshot of all recorded metrics.
+ * @details Each metric is reported as one line of the form
+ * "name,count=<n>,p50_us=<n>,p99_us=<n>,max_us=<n>".
+ * @return The newly allocated string with the snapshot. Caller should release it using g_free().
+ */
+gchar *ml_metrics_report (void);
+
+G_END_DECLS
+#endif /* __METRICS_UTIL_H__ */
@@ -9,13 +9,18 @@
  */
 
 #include <errno.h>
+#include <gio/gunixfdlist.h>
 #include <glib.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 #include "include/mlops-agent-interface.h"
 #include "dbus-interface.h"
+#include "event-util.h"
 #include "model-dbus.h"
 #include "pipeline-dbus.h"
 #include "resource-dbus.h"
+#include "service-db-util.h"
 
 #define STR_IS_VALID(s) ((s) && (s)[0] != '\0')
 
@@ -29,19 +34,77 @@ typedef enum
 
 typedef gpointer ml_agent_proxy_h;
 
+static ml_agent_proxy_h g_proxy_cache[ML_AGENT_SERVICE_END] = { NULL };
+static GBusType g_proxy_bus_type = G_BUS_TYPE_NONE;
+G_LOCK_DEFINE_STATIC (proxy_cache);
+
+static gboolean g_direct_mode = FALSE;
+
 /**
- * @brief An internal helper to get the dbus proxy
+ * @brief Check whether the in-process direct mode is in use.
+ * @details In direct mode, the DB-backed calls go to the svcdb layer of this
+ * process instead of the daemon, skipping proxy creation, marshalling, and
+ * two context switches per call. It is meant for builds that do not run the
+ * daemon; it must not be enabled next to a running daemon, as the database
+ * would then be written from two processes. Besides
+ * ml_agent_direct_mode_enable(), setting the ML_AGENT_DIRECT_DB_PATH
+ * environment variable enables it on the first call.
+ */
+static gboolean
+_direct_mode (void)
+{
+  static gsize checked = 0;
+
+  if (g_once_init_enter (&checked)) {
+    const gchar *path = g_getenv ("ML_AGENT_DIRECT_DB_PATH");
+
+    if (STR_IS_VALID (path) && svcdb_initialize_checked (path) == 0)
+      g_direct_mode = TRUE;
+
+    g_once_init_leave (&checked, 1);
+  }
+
+  return g_direct_mode;
+}
+
+/**
+ * @brief An interface exported for enabling the in-process direct mode.
+ */
+gint
+ml_agent_direct_mode_enable (const gchar * db_path)
+{
+  gint ret;
+
+  if (!STR_IS_VALID (db_path)) {
+    g_return_val_if_reached (-EINVAL);
+  }
+
+  ret = svcdb_initialize_checked (db_path);
+  g_return_val_if_fail (ret == 0, ret);
+
+  g_direct_mode = TRUE;
+  return 0;
+}
+
+/**
+ * @brief An internal helper to create a new dbus proxy
  */
 static ml_agent_proxy_h
-_get_proxy_new_for_bus_sync (ml_agent_service_type_e type, GError ** err)
+_proxy_new_for_bus_sync (ml_agent_service_type_e type, GError ** err)
 {
-  static const GBusType bus_types[] = { G_BUS_TYPE_SYSTEM, G_BUS_TYPE_SESSION };
+  GBusType bus_types[] = { G_BUS_TYPE_SYSTEM, G_BUS_TYPE_SESSION };
   static const size_t num_bus_types =
       sizeof (bus_types) / sizeof (bus_types[0]);
   ml_agent_proxy_h *proxy = NULL;
   GError *_err = NULL;
   size_t i;
 
+  /* Try the bus type that succeeded before first. */
+  if (g_proxy_bus_type == G_BUS_TYPE_SESSION) {
+    bus_types[0] = G_BUS_TYPE_SESSION;
+    bus_types[1] = G_BUS_TYPE_SYSTEM;
+  }
+
   switch (type) {
     case ML_AGENT_SERVICE_PIPELINE:
     {
@@ -96,14 +159,56 @@ _get_proxy_new_for_bus_sync (ml_agent_service_type_e type, GError ** err)
       break;
   }
 
+  if (proxy && i < num_bus_types)
+    g_proxy_bus_type = bus_types[i];
+
   if (_err) {
-    *err = g_error_copy (_err);
+    if (err)
+      *err = g_error_copy (_err);
     g_clear_error (&_err);
   }
 
   return proxy;
 }
 
+/**
+ * @brief An internal helper to get the dbus proxy
+ * @details The proxy of each service type is created once and cached, so
+ * steady-state calls skip the bus round trip of proxy creation. The cache
+ * is dropped when the bus connection is closed. The caller should release
+ * the returned proxy with g_object_unref().
+ */
+static ml_agent_proxy_h
+_get_proxy_new_for_bus_sync (ml_agent_service_type_e type, GError ** err)
+{
+  gpointer proxy;
+
+  if (type < 0 || type >= ML_AGENT_SERVICE_END)
+    return NULL;
+
+  G_LOCK (proxy_cache);
+  proxy = g_proxy_cache[type];
+  if (proxy &&
+      g_dbus_connection_is_closed (g_dbus_proxy_get_connection (G_DBUS_PROXY (proxy)))) {
+    /* The cached proxies share the bus connection, drop all of them. */
+    size_t i;
+
+    for (i = 0; i < ML_AGENT_SERVICE_END; ++i)
+      g_clear_object (&g_proxy_cache[i]);
+    g_proxy_bus_type = G_BUS_TYPE_NONE;
+    proxy = NULL;
+  }
+
+  if (!proxy)
+    proxy = g_proxy_cache[type] = _proxy_new_for_bus_sync (type, err);
+
+  if (proxy)
+    g_object_ref (proxy);
+  G_UNLOCK (proxy_cache);
+
+  return proxy;
+}
+
 /**
  * @brief An interface exported for setting the description of a pipeline.
  */
@@ -118,6 +223,13 @@ ml_agent_pipeline_set_description (const gchar * name,
     g_return_val_if_reached (-EINVAL);
   }
 
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_pipeline_set (name, pipeline_desc);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
   mlsp = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_PIPELINE, err);
   if (!mlsp) {
     g_return_val_if_reached (-EIO);
@@ -146,6 +258,13 @@ ml_agent_pipeline_get_description (const gchar * name,
     g_return_val_if_reached (-EINVAL);
   }
 
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_pipeline_get (name, pipeline_desc);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
   mlsp = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_PIPELINE, err);
   if (!mlsp) {
     g_return_val_if_reached (-EIO);
@@ -173,6 +292,13 @@ ml_agent_pipeline_delete (const gchar * name, GError ** err)
     g_return_val_if_reached (-EINVAL);
   }
 
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_pipeline_delete (name);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
   mlsp = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_PIPELINE, err);
   if (!mlsp) {
     g_return_val_if_reached (-EIO);
@@ -213,6 +339,33 @@ ml_agent_pipeline_launch (const gchar * name, gint64 * id, GError ** err)
   return 0;
 }
 
+/**
+ * @brief An interface exported for pre-parsing the pipeline of the given @a name into the warm pool.
+ */
+gint
+ml_agent_pipeline_prewarm (const gchar * name, GError ** err)
+{
+  MachinelearningServicePipeline *mlsp;
+  gboolean result;
+  gint ret;
+
+  if (!STR_IS_VALID (name)) {
+    g_return_val_if_reached (-EINVAL);
+  }
+
+  mlsp = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_PIPELINE, err);
+  if (!mlsp) {
+    g_return_val_if_reached (-EIO);
+  }
+
+  result = machinelearning_service_pipeline_call_prewarm_pipeline_sync (mlsp,
+      name, &ret, NULL, err);
+  g_object_unref (mlsp);
+
+  g_return_val_if_fail (ret == 0 && result, ret);
+  return 0;
+}
+
 /**
  * @brief An interface exported for changing the pipeline's state of the given @a id to start.
  */
@@ -325,6 +478,14 @@ ml_agent_model_register (const gchar * name, const gchar * path,
     g_return_val_if_reached (-EINVAL);
   }
 
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_model_add (name, path, activate,
+        description ? description : "", app_info ? app_info : "", version);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
   mlsm = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_MODEL, err);
   if (!mlsm) {
     g_return_val_if_reached (-EIO);
@@ -339,6 +500,41 @@ ml_agent_model_register (const gchar * name, const gchar * path,
   return 0;
 }
 
+/**
+ * @brief An interface exported for registering multiple models in a single transaction.
+ */
+gint
+ml_agent_model_register_many (GVariant * models, GVariant ** versions,
+    GError ** err)
+{
+  MachinelearningServiceModel *mlsm;
+  gboolean result;
+  gint ret;
+
+  if (!models || !versions) {
+    g_return_val_if_reached (-EINVAL);
+  }
+
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_model_add_many (models, versions);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
+  mlsm = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_MODEL, err);
+  if (!mlsm) {
+    g_return_val_if_reached (-EIO);
+  }
+
+  result = machinelearning_service_model_call_register_many_sync (mlsm,
+      models, versions, &ret, NULL, err);
+  g_object_unref (mlsm);
+
+  g_return_val_if_fail (ret == 0 && result, ret);
+  return 0;
+}
+
 /**
  * @brief An interface exported for updating the description of the model with @a name and @a version.
  */
@@ -354,6 +550,13 @@ ml_agent_model_update_description (const gchar * name,
     g_return_val_if_reached (-EINVAL);
   }
 
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_model_update_description (name, version, description);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
   mlsm = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_MODEL, err);
   if (!mlsm) {
     g_return_val_if_reached (-EIO);
@@ -381,6 +584,13 @@ ml_agent_model_activate (const gchar * name, const guint version, GError ** err)
     g_return_val_if_reached (-EINVAL);
   }
 
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_model_activate (name, version);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
   mlsm = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_MODEL, err);
   if (!mlsm) {
     g_return_val_if_reached (-EIO);
@@ -409,6 +619,13 @@ ml_agent_model_get (const gchar * name, const guint version,
     g_return_val_if_reached (-EINVAL);
   }
 
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_model_get (name, version, model_info);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
   mlsm = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_MODEL, err);
   if (!mlsm) {
     g_return_val_if_reached (-EIO);
@@ -437,6 +654,13 @@ ml_agent_model_get_activated (const gchar * name,
     g_return_val_if_reached (-EINVAL);
   }
 
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_model_get_activated (name, model_info);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
   mlsm = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_MODEL, err);
   if (!mlsm) {
     g_return_val_if_reached (-EIO);
@@ -450,6 +674,57 @@ ml_agent_model_get_activated (const gchar * name,
   return 0;
 }
 
+/**
+ * @brief An internal helper to read the model information over the sealed memfd.
+ * @return 0 on success, a negative value if the fast path is not available.
+ */
+static gint
+_model_get_all_fd (MachinelearningServiceModel * mlsm,
+    const gchar * name, gchar ** model_info)
+{
+  GUnixFDList *fd_list = NULL;
+  GError *_err = NULL;
+  gboolean result;
+  guint64 size = 0;
+  gint ret, handle = -1, fd = -1;
+  gpointer map;
+
+  result = machinelearning_service_model_call_get_all_fd_sync (mlsm,
+      name, NULL, &handle, &size, &ret, &fd_list, NULL, &_err);
+  if (!result || !fd_list) {
+    g_clear_error (&_err);
+    g_clear_object (&fd_list);
+    return -EIO;
+  }
+
+  if (ret != 0) {
+    g_object_unref (fd_list);
+    return ret;
+  }
+
+  fd = g_unix_fd_list_get (fd_list, handle, NULL);
+  g_object_unref (fd_list);
+  if (fd < 0)
+    return -EIO;
+
+  if (size == 0) {
+    close (fd);
+    *model_info = g_strdup ("");
+    return 0;
+  }
+
+  /* The daemon sealed the buffer, map it read-only and copy it out once. */
+  map = mmap (NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close (fd);
+  if (map == MAP_FAILED)
+    return -EIO;
+
+  *model_info = g_strndup ((const gchar *) map, size);
+  munmap (map, size);
+
+  return 0;
+}
+
 /**
  * @brief An interface exported for getting the information of all the models corresponding to the given @a name.
  */
@@ -464,11 +739,26 @@ ml_agent_model_get_all (const gchar * name, gchar ** model_info, GError ** err)
     g_return_val_if_reached (-EINVAL);
   }
 
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_model_get_all (name, model_info);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
   mlsm = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_MODEL, err);
   if (!mlsm) {
     g_return_val_if_reached (-EIO);
   }
 
+  /* Large blobs travel over a sealed memfd, keeping the bus out of the data path. */
+  ret = _model_get_all_fd (mlsm, name, model_info);
+  if (ret <= 0 && ret != -EIO) {
+    g_object_unref (mlsm);
+    g_return_val_if_fail (ret == 0, ret);
+    return 0;
+  }
+
   result = machinelearning_service_model_call_get_all_sync (mlsm,
       name, model_info, &ret, NULL, err);
   g_object_unref (mlsm);
@@ -477,6 +767,43 @@ ml_agent_model_get_all (const gchar * name, gchar ** model_info, GError ** err)
   return 0;
 }
 
+/**
+ * @brief An interface exported for listing the registered models page by page.
+ */
+gint
+ml_agent_model_list (const gchar * filter, const gint active_state,
+    const guint offset, const guint limit, gchar ** model_list, GError ** err)
+{
+  MachinelearningServiceModel *mlsm;
+  gboolean result;
+  gint ret;
+
+  if (!model_list || limit == 0U) {
+    g_return_val_if_reached (-EINVAL);
+  }
+
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_model_list (filter ? filter : "", active_state,
+        offset, limit, model_list);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
+  mlsm = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_MODEL, err);
+  if (!mlsm) {
+    g_return_val_if_reached (-EIO);
+  }
+
+  result = machinelearning_service_model_call_list_sync (mlsm,
+      filter ? filter : "", active_state, offset, limit, model_list, &ret,
+      NULL, err);
+  g_object_unref (mlsm);
+
+  g_return_val_if_fail (ret == 0 && result, ret);
+  return 0;
+}
+
 /**
  * @brief An interface exported for removing the model of @a name and @a version.
  */
@@ -491,6 +818,13 @@ ml_agent_model_delete (const gchar * name, const guint version, GError ** err)
     g_return_val_if_reached (-EINVAL);
   }
 
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_model_delete (name, version);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
   mlsm = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_MODEL, err);
   if (!mlsm) {
     g_return_val_if_reached (-EIO);
@@ -519,6 +853,14 @@ ml_agent_resource_add (const gchar * name, const gchar * path,
     g_return_val_if_reached (-EINVAL);
   }
 
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_resource_add (name, path,
+        description ? description : "", app_info ? app_info : "");
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
   mlsr = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_RESOURCE, err);
   if (!mlsr) {
     g_return_val_if_reached (-EIO);
@@ -533,6 +875,40 @@ ml_agent_resource_add (const gchar * name, const gchar * path,
   return 0;
 }
 
+/**
+ * @brief An interface exported for adding multiple resources in a single transaction.
+ */
+gint
+ml_agent_resource_add_many (GVariant * resources, GError ** err)
+{
+  MachinelearningServiceResource *mlsr;
+  gboolean result;
+  gint ret;
+
+  if (!resources) {
+    g_return_val_if_reached (-EINVAL);
+  }
+
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_resource_add_many (resources);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
+  mlsr = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_RESOURCE, err);
+  if (!mlsr) {
+    g_return_val_if_reached (-EIO);
+  }
+
+  result = machinelearning_service_resource_call_add_many_sync (mlsr,
+      resources, &ret, NULL, err);
+  g_object_unref (mlsr);
+
+  g_return_val_if_fail (ret == 0 && result, ret);
+  return 0;
+}
+
 /**
  * @brief An interface exported for removing the resource with @a name.
  */
@@ -547,6 +923,13 @@ ml_agent_resource_delete (const gchar * name, GError ** err)
     g_return_val_if_reached (-EINVAL);
   }
 
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_resource_delete (name);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
   mlsr = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_RESOURCE, err);
   if (!mlsr) {
     g_return_val_if_reached (-EIO);
@@ -574,6 +957,13 @@ ml_agent_resource_get (const gchar * name, gchar ** res_info, GError ** err)
     g_return_val_if_reached (-EINVAL);
   }
 
+  if (_direct_mode ()) {
+    gint direct_ret = svcdb_resource_get (name, res_info);
+
+    g_return_val_if_fail (direct_ret == 0, direct_ret);
+    return 0;
+  }
+
   mlsr = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_RESOURCE, err);
   if (!mlsr) {
     g_return_val_if_reached (-EIO);
@@ -586,3 +976,1428 @@ ml_agent_resource_get (const gchar * name, gchar ** res_info, GError ** err)
   g_return_val_if_fail (ret == 0 && result, ret);
   return 0;
 }
+
+/**
+ * The asynchronous variants below mirror the synchronous calls one to one.
+ * Each *_async() call copies its arguments, runs the matching synchronous
+ * call on a task thread, and completes the GTask; the *_finish() call hands
+ * the out values over. The error semantics are therefore identical to the
+ * synchronous API, with -ECANCELED added for a cancelled call.
+ */
+
+/**
+ * @brief Data of an asynchronous ml_agent call. It holds copies of the in
+ * arguments and the out values until the finish call picks them up.
+ */
+typedef struct
+{
+  gchar *name;
+  gchar *path;
+  gchar *description;
+  gchar *app_info;
+  gboolean activate;
+  gint64 id;
+  guint version;
+  gint active_state;
+  guint offset;
+  guint limit;
+  GVariant *in_variant;
+  gchar *out_info;
+  gint64 out_id;
+  guint out_version;
+  gint out_state;
+  GVariant *out_variant;
+} ml_agent_async_data_s;
+
+/**
+ * @brief An internal helper to release the data of an asynchronous call.
+ */
+static void
+_async_data_free (gpointer data)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) data;
+
+  g_free (d->name);
+  g_free (d->path);
+  g_free (d->description);
+  g_free (d->app_info);
+  g_free (d->out_info);
+  if (d->in_variant)
+    g_variant_unref (d->in_variant);
+  if (d->out_variant)
+    g_variant_unref (d->out_variant);
+  g_free (d);
+}
+
+/**
+ * @brief An internal helper to propagate the result of an asynchronous call.
+ */
+static gint
+_async_task_propagate (GAsyncResult * result, gpointer source_tag,
+    GError ** err)
+{
+  GError *error = NULL;
+  gssize ret;
+
+  if (!g_task_is_valid (result, NULL)
+      || g_task_get_source_tag (G_TASK (result)) != source_tag) {
+    g_return_val_if_reached (-EINVAL);
+  }
+
+  ret = g_task_propagate_int (G_TASK (result), &error);
+  if (error) {
+    gint rc = g_error_matches (error, G_IO_ERROR, G_IO_ERROR_CANCELLED) ?
+        -ECANCELED : -EIO;
+
+    if (err)
+      *err = error;
+    else
+      g_error_free (error);
+    return rc;
+  }
+
+  return (gint) ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_pipeline_set_description_async().
+ */
+static void
+_pipeline_set_description_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_pipeline_set_description (d->name, d->description, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_set_description().
+ */
+gint
+ml_agent_pipeline_set_description_async (const gchar * name, const gchar * pipeline_desc, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+  d->description = g_strdup (pipeline_desc);
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_pipeline_set_description_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _pipeline_set_description_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_pipeline_set_description_async().
+ */
+gint
+ml_agent_pipeline_set_description_finish (GAsyncResult * result, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_pipeline_set_description_async, err);
+
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_pipeline_get_description_async().
+ */
+static void
+_pipeline_get_description_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_pipeline_get_description (d->name, &d->out_info, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_get_description().
+ */
+gint
+ml_agent_pipeline_get_description_async (const gchar * name, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_pipeline_get_description_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _pipeline_get_description_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_pipeline_get_description_async().
+ */
+gint
+ml_agent_pipeline_get_description_finish (GAsyncResult * result, gchar ** pipeline_desc, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_pipeline_get_description_async, err);
+
+  if (ret == 0 && pipeline_desc) {
+    ml_agent_async_data_s *d =
+        (ml_agent_async_data_s *) g_task_get_task_data (G_TASK (result));
+
+    *pipeline_desc = g_steal_pointer (&d->out_info);
+  }
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_pipeline_delete_async().
+ */
+static void
+_pipeline_delete_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_pipeline_delete (d->name, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_delete().
+ */
+gint
+ml_agent_pipeline_delete_async (const gchar * name, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_pipeline_delete_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _pipeline_delete_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_pipeline_delete_async().
+ */
+gint
+ml_agent_pipeline_delete_finish (GAsyncResult * result, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_pipeline_delete_async, err);
+
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_pipeline_launch_async().
+ */
+static void
+_pipeline_launch_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_pipeline_launch (d->name, &d->out_id, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_launch().
+ */
+gint
+ml_agent_pipeline_launch_async (const gchar * name, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_pipeline_launch_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _pipeline_launch_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_pipeline_launch_async().
+ */
+gint
+ml_agent_pipeline_launch_finish (GAsyncResult * result, gint64 * id, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_pipeline_launch_async, err);
+
+  if (ret == 0 && id) {
+    ml_agent_async_data_s *d =
+        (ml_agent_async_data_s *) g_task_get_task_data (G_TASK (result));
+
+    *id = d->out_id;
+  }
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_pipeline_prewarm_async().
+ */
+static void
+_pipeline_prewarm_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_pipeline_prewarm (d->name, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_prewarm().
+ */
+gint
+ml_agent_pipeline_prewarm_async (const gchar * name, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_pipeline_prewarm_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _pipeline_prewarm_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_pipeline_prewarm_async().
+ */
+gint
+ml_agent_pipeline_prewarm_finish (GAsyncResult * result, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_pipeline_prewarm_async, err);
+
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_pipeline_start_async().
+ */
+static void
+_pipeline_start_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_pipeline_start (d->id, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_start().
+ */
+gint
+ml_agent_pipeline_start_async (const gint64 id, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->id = id;
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_pipeline_start_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _pipeline_start_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_pipeline_start_async().
+ */
+gint
+ml_agent_pipeline_start_finish (GAsyncResult * result, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_pipeline_start_async, err);
+
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_pipeline_stop_async().
+ */
+static void
+_pipeline_stop_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_pipeline_stop (d->id, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_stop().
+ */
+gint
+ml_agent_pipeline_stop_async (const gint64 id, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->id = id;
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_pipeline_stop_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _pipeline_stop_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_pipeline_stop_async().
+ */
+gint
+ml_agent_pipeline_stop_finish (GAsyncResult * result, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_pipeline_stop_async, err);
+
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_pipeline_destroy_async().
+ */
+static void
+_pipeline_destroy_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_pipeline_destroy (d->id, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_destroy().
+ */
+gint
+ml_agent_pipeline_destroy_async (const gint64 id, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->id = id;
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_pipeline_destroy_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _pipeline_destroy_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_pipeline_destroy_async().
+ */
+gint
+ml_agent_pipeline_destroy_finish (GAsyncResult * result, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_pipeline_destroy_async, err);
+
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_pipeline_get_state_async().
+ */
+static void
+_pipeline_get_state_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_pipeline_get_state (d->id, &d->out_state, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_pipeline_get_state().
+ */
+gint
+ml_agent_pipeline_get_state_async (const gint64 id, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->id = id;
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_pipeline_get_state_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _pipeline_get_state_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_pipeline_get_state_async().
+ */
+gint
+ml_agent_pipeline_get_state_finish (GAsyncResult * result, gint * state, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_pipeline_get_state_async, err);
+
+  if (ret == 0 && state) {
+    ml_agent_async_data_s *d =
+        (ml_agent_async_data_s *) g_task_get_task_data (G_TASK (result));
+
+    *state = d->out_state;
+  }
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_model_register_async().
+ */
+static void
+_model_register_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_model_register (d->name, d->path, d->activate,
+      d->description, d->app_info, &d->out_version, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_register().
+ */
+gint
+ml_agent_model_register_async (const gchar * name, const gchar * path, const gboolean activate, const gchar * description, const gchar * app_info, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+  d->path = g_strdup (path);
+  d->activate = activate;
+  d->description = g_strdup (description);
+  d->app_info = g_strdup (app_info);
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_model_register_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _model_register_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_model_register_async().
+ */
+gint
+ml_agent_model_register_finish (GAsyncResult * result, guint * version, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_model_register_async, err);
+
+  if (ret == 0 && version) {
+    ml_agent_async_data_s *d =
+        (ml_agent_async_data_s *) g_task_get_task_data (G_TASK (result));
+
+    *version = d->out_version;
+  }
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_model_register_many_async().
+ */
+static void
+_model_register_many_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_model_register_many (d->in_variant, &d->out_variant, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_register_many().
+ */
+gint
+ml_agent_model_register_many_async (GVariant * models, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->in_variant = g_variant_ref_sink (models);
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_model_register_many_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _model_register_many_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_model_register_many_async().
+ */
+gint
+ml_agent_model_register_many_finish (GAsyncResult * result, GVariant ** versions, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_model_register_many_async, err);
+
+  if (ret == 0 && versions) {
+    ml_agent_async_data_s *d =
+        (ml_agent_async_data_s *) g_task_get_task_data (G_TASK (result));
+
+    *versions = g_steal_pointer (&d->out_variant);
+  }
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_model_update_description_async().
+ */
+static void
+_model_update_description_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_model_update_description (d->name, d->version,
+      d->description, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_update_description().
+ */
+gint
+ml_agent_model_update_description_async (const gchar * name, const guint version, const gchar * description, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+  d->version = version;
+  d->description = g_strdup (description);
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_model_update_description_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _model_update_description_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_model_update_description_async().
+ */
+gint
+ml_agent_model_update_description_finish (GAsyncResult * result, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_model_update_description_async, err);
+
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_model_activate_async().
+ */
+static void
+_model_activate_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_model_activate (d->name, d->version, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_activate().
+ */
+gint
+ml_agent_model_activate_async (const gchar * name, const guint version, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+  d->version = version;
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_model_activate_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _model_activate_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_model_activate_async().
+ */
+gint
+ml_agent_model_activate_finish (GAsyncResult * result, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_model_activate_async, err);
+
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_model_get_async().
+ */
+static void
+_model_get_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_model_get (d->name, d->version, &d->out_info, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_get().
+ */
+gint
+ml_agent_model_get_async (const gchar * name, const guint version, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+  d->version = version;
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_model_get_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _model_get_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_model_get_async().
+ */
+gint
+ml_agent_model_get_finish (GAsyncResult * result, gchar ** model_info, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_model_get_async, err);
+
+  if (ret == 0 && model_info) {
+    ml_agent_async_data_s *d =
+        (ml_agent_async_data_s *) g_task_get_task_data (G_TASK (result));
+
+    *model_info = g_steal_pointer (&d->out_info);
+  }
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_model_get_activated_async().
+ */
+static void
+_model_get_activated_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_model_get_activated (d->name, &d->out_info, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_get_activated().
+ */
+gint
+ml_agent_model_get_activated_async (const gchar * name, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_model_get_activated_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _model_get_activated_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_model_get_activated_async().
+ */
+gint
+ml_agent_model_get_activated_finish (GAsyncResult * result, gchar ** model_info, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_model_get_activated_async, err);
+
+  if (ret == 0 && model_info) {
+    ml_agent_async_data_s *d =
+        (ml_agent_async_data_s *) g_task_get_task_data (G_TASK (result));
+
+    *model_info = g_steal_pointer (&d->out_info);
+  }
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_model_get_all_async().
+ */
+static void
+_model_get_all_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_model_get_all (d->name, &d->out_info, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_get_all().
+ */
+gint
+ml_agent_model_get_all_async (const gchar * name, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_model_get_all_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _model_get_all_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_model_get_all_async().
+ */
+gint
+ml_agent_model_get_all_finish (GAsyncResult * result, gchar ** model_info, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_model_get_all_async, err);
+
+  if (ret == 0 && model_info) {
+    ml_agent_async_data_s *d =
+        (ml_agent_async_data_s *) g_task_get_task_data (G_TASK (result));
+
+    *model_info = g_steal_pointer (&d->out_info);
+  }
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_model_list_async().
+ */
+static void
+_model_list_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_model_list (d->name, d->active_state, d->offset,
+      d->limit, &d->out_info, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_list().
+ */
+gint
+ml_agent_model_list_async (const gchar * filter, const gint active_state, const guint offset, const guint limit, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (filter);
+  d->active_state = active_state;
+  d->offset = offset;
+  d->limit = limit;
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_model_list_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _model_list_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_model_list_async().
+ */
+gint
+ml_agent_model_list_finish (GAsyncResult * result, gchar ** model_list, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_model_list_async, err);
+
+  if (ret == 0 && model_list) {
+    ml_agent_async_data_s *d =
+        (ml_agent_async_data_s *) g_task_get_task_data (G_TASK (result));
+
+    *model_list = g_steal_pointer (&d->out_info);
+  }
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_model_delete_async().
+ */
+static void
+_model_delete_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_model_delete (d->name, d->version, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_model_delete().
+ */
+gint
+ml_agent_model_delete_async (const gchar * name, const guint version, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+  d->version = version;
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_model_delete_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _model_delete_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_model_delete_async().
+ */
+gint
+ml_agent_model_delete_finish (GAsyncResult * result, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_model_delete_async, err);
+
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_resource_add_async().
+ */
+static void
+_resource_add_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_resource_add (d->name, d->path, d->description,
+      d->app_info, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_resource_add().
+ */
+gint
+ml_agent_resource_add_async (const gchar * name, const gchar * path, const gchar * description, const gchar * app_info, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+  d->path = g_strdup (path);
+  d->description = g_strdup (description);
+  d->app_info = g_strdup (app_info);
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_resource_add_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _resource_add_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_resource_add_async().
+ */
+gint
+ml_agent_resource_add_finish (GAsyncResult * result, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_resource_add_async, err);
+
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_resource_add_many_async().
+ */
+static void
+_resource_add_many_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_resource_add_many (d->in_variant, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_resource_add_many().
+ */
+gint
+ml_agent_resource_add_many_async (GVariant * resources, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->in_variant = g_variant_ref_sink (resources);
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_resource_add_many_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _resource_add_many_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_resource_add_many_async().
+ */
+gint
+ml_agent_resource_add_many_finish (GAsyncResult * result, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_resource_add_many_async, err);
+
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_resource_delete_async().
+ */
+static void
+_resource_delete_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_resource_delete (d->name, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_resource_delete().
+ */
+gint
+ml_agent_resource_delete_async (const gchar * name, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_resource_delete_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _resource_delete_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_resource_delete_async().
+ */
+gint
+ml_agent_resource_delete_finish (GAsyncResult * result, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_resource_delete_async, err);
+
+  return ret;
+}
+
+/**
+ * @brief GTaskThreadFunc for ml_agent_resource_get_async().
+ */
+static void
+_resource_get_thread (GTask * task, gpointer source, gpointer task_data,
+    GCancellable * cancellable)
+{
+  ml_agent_async_data_s *d = (ml_agent_async_data_s *) task_data;
+  GError *error = NULL;
+  gint ret;
+
+  ret = ml_agent_resource_get (d->name, &d->out_info, &error);
+
+  if (error)
+    g_task_return_error (task, error);
+  else
+    g_task_return_int (task, ret);
+}
+
+/**
+ * @brief An asynchronous variant of ml_agent_resource_get().
+ */
+gint
+ml_agent_resource_get_async (const gchar * name, GCancellable * cancellable,
+    GAsyncReadyCallback callback, gpointer user_data)
+{
+  GTask *task;
+  ml_agent_async_data_s *d;
+
+  d = g_new0 (ml_agent_async_data_s, 1);
+  d->name = g_strdup (name);
+
+  task = g_task_new (NULL, cancellable, callback, user_data);
+  g_task_set_source_tag (task, (gpointer) ml_agent_resource_get_async);
+  g_task_set_task_data (task, d, _async_data_free);
+  g_task_run_in_thread (task, _resource_get_thread);
+  g_object_unref (task);
+
+  return 0;
+}
+
+/**
+ * @brief Get the result of ml_agent_resource_get_async().
+ */
+gint
+ml_agent_resource_get_finish (GAsyncResult * result, gchar ** res_info, GError ** err)
+{
+  gint ret =
+      _async_task_propagate (result, (gpointer) ml_agent_resource_get_async, err);
+
+  if (ret == 0 && res_info) {
+    ml_agent_async_data_s *d =
+        (ml_agent_async_data_s *) g_task_get_task_data (G_TASK (result));
+
+    *res_info = g_steal_pointer (&d->out_info);
+  }
+  return ret;
+}
+
+static ml_agent_event_cb g_event_callback = NULL;
+static gpointer g_event_user_data = NULL;
+static guint32 g_event_cursor = 0;
+static gpointer g_event_proxy_pipeline = NULL;
+static gpointer g_event_proxy_model = NULL;
+static gulong g_event_handler_pipeline = 0;
+static gulong g_event_handler_model = 0;
+
+/**
+ * @brief Signal handler draining the shared-memory ring on a wakeup.
+ * @details The D-Bus signal carries no payload; the events are read from
+ * the ring, so one broadcast wakes every subscriber without per-subscriber
+ * work in the daemon.
+ */
+static void
+_event_wakeup_cb (gpointer obj, gpointer user_data)
+{
+  ml_event_s event;
+
+  while (ml_event_sub_read (&g_event_cursor, &event) == 0) {
+    ml_agent_event_s out;
+
+    out.type = (ml_agent_event_e) event.type;
+    out.id = event.id;
+    out.state = event.state;
+    out.version = event.version;
+    out.name = event.name;
+
+    if (g_event_callback)
+      g_event_callback (&out, g_event_user_data);
+  }
+}
+
+/**
+ * @brief An interface exported for subscribing to the change events of the agent daemon.
+ */
+gint
+ml_agent_subscribe_events (ml_agent_event_cb callback, gpointer user_data)
+{
+  MachinelearningServicePipeline *mlsp;
+  MachinelearningServiceModel *mlsm;
+  gint ret;
+
+  if (!callback) {
+    g_return_val_if_reached (-EINVAL);
+  }
+
+  if (g_event_callback)
+    return -EBUSY;
+
+  ret = ml_event_sub_open (&g_event_cursor);
+  if (ret < 0)
+    return ret;
+
+  mlsp = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_PIPELINE, NULL);
+  mlsm = _get_proxy_new_for_bus_sync (ML_AGENT_SERVICE_MODEL, NULL);
+  if (!mlsp || !mlsm) {
+    g_clear_object (&mlsp);
+    g_clear_object (&mlsm);
+    ml_event_sub_close ();
+    g_return_val_if_reached (-EIO);
+  }
+
+  g_event_callback = callback;
+  g_event_user_data = user_data;
+  g_event_proxy_pipeline = mlsp;
+  g_event_proxy_model = mlsm;
+  g_event_handler_pipeline = g_signal_connect (mlsp, "changed",
+      G_CALLBACK (_event_wakeup_cb), NULL);
+  g_event_handler_model = g_signal_connect (mlsm, "changed",
+      G_CALLBACK (_event_wakeup_cb), NULL);
+
+  return 0;
+}
+
+/**
+ * @brief An interface exported for cancelling the subscription made with ml_agent_subscribe_events().
+ */
+gint
+ml_agent_unsubscribe_events (void)
+{
+  if (!g_event_callback)
+    return -EINVAL;
+
+  g_signal_handler_disconnect (g_event_proxy_pipeline, g_event_handler_pipeline);
+  g_signal_handler_disconnect (g_event_proxy_model, g_event_handler_model);
+  g_clear_object (&g_event_proxy_pipeline);
+  g_clear_object (&g_event_proxy_model);
+  g_event_handler_pipeline = g_event_handler_model = 0;
+
+  g_event_callback = NULL;
+  g_event_user_data = NULL;
+  ml_event_sub_close ();
+
+  return 0;
+}
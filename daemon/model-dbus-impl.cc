@@ -11,12 +11,16 @@
  */
 
 #include <errno.h>
+#include <gio/gunixfdlist.h>
 #include <glib.h>
+#include <string.h>
 
 #include "common.h"
 #include "dbus-interface.h"
+#include "event-util.h"
 #include "gdbus-util.h"
 #include "log.h"
+#include "metrics-util.h"
 #include "model-dbus.h"
 #include "modules.h"
 #include "service-db-util.h"
@@ -41,6 +45,185 @@ gdbus_put_model_instance (MachinelearningServiceModel **instance)
   g_clear_object (instance);
 }
 
+/**
+ * @brief Structure for the dispatched method invocation.
+ */
+typedef struct _model_dispatch_request {
+  MachinelearningServiceModel *obj;
+  GDBusMethodInvocation *invoc;
+} model_dispatch_request_s;
+
+/**
+ * @brief Worker function to handle one method invocation of the Model interface.
+ * @details The method arguments are re-extracted from the invocation handle,
+ * which stays alive until the invocation is completed.
+ */
+static void
+_model_dispatch_worker (gpointer data)
+{
+  model_dispatch_request_s *req = (model_dispatch_request_s *) data;
+  MachinelearningServiceModel *obj = req->obj;
+  GDBusMethodInvocation *invoc = req->invoc;
+  const gchar *method = g_dbus_method_invocation_get_method_name (invoc);
+  GVariant *params = g_dbus_method_invocation_get_parameters (invoc);
+  g_autofree gchar *metric_name = g_strdup_printf ("dbus.model.%s", method);
+  gint64 metric_start = g_get_monotonic_time ();
+  gint ret = 0;
+
+  if (g_str_equal (method, "Register")) {
+    const gchar *name, *path, *description, *app_info;
+    gboolean is_active;
+    guint version = 0U;
+
+    g_variant_get (params, "(&s&sb&s&s)", &name, &path, &is_active, &description, &app_info);
+    ret = svcdb_model_add (name, path, is_active, description, app_info, &version);
+    if (ret == 0 && is_active) {
+      ml_event_publish (ML_EVENT_MODEL_ACTIVATED, 0, 0, version, name);
+      machinelearning_service_model_emit_changed (obj);
+    }
+    machinelearning_service_model_complete_register (obj, invoc, version, ret);
+  } else if (g_str_equal (method, "RegisterMany")) {
+    g_autoptr (GVariant) models = NULL;
+    GVariant *versions = NULL;
+
+    g_variant_get (params, "(@a(ssbss))", &models);
+    ret = svcdb_model_add_many (models, &versions);
+    if (ret == 0) {
+      const gchar *name, *path, *description, *app_info;
+      gboolean is_active, changed = FALSE;
+      GVariantIter iter;
+      gsize idx = 0;
+
+      /* Publish the activation of each active entry, as Register does. */
+      g_variant_iter_init (&iter, models);
+      while (g_variant_iter_next (&iter, "(&s&sb&s&s)", &name, &path,
+          &is_active, &description, &app_info)) {
+        if (is_active) {
+          guint version = 0U;
+
+          g_variant_get_child (versions, idx, "u", &version);
+          ml_event_publish (ML_EVENT_MODEL_ACTIVATED, 0, 0, version, name);
+          changed = TRUE;
+        }
+        idx++;
+      }
+      if (changed)
+        machinelearning_service_model_emit_changed (obj);
+    }
+    machinelearning_service_model_complete_register_many (obj, invoc, versions, ret);
+  } else if (g_str_equal (method, "UpdateDescription")) {
+    const gchar *name, *description;
+    guint version;
+
+    g_variant_get (params, "(&su&s)", &name, &version, &description);
+    ret = svcdb_model_update_description (name, version, description);
+    machinelearning_service_model_complete_update_description (obj, invoc, ret);
+  } else if (g_str_equal (method, "Activate")) {
+    const gchar *name;
+    guint version;
+
+    g_variant_get (params, "(&su)", &name, &version);
+    ret = svcdb_model_activate (name, version);
+    if (ret == 0) {
+      ml_event_publish (ML_EVENT_MODEL_ACTIVATED, 0, 0, version, name);
+      machinelearning_service_model_emit_changed (obj);
+    }
+    machinelearning_service_model_complete_activate (obj, invoc, ret);
+  } else if (g_str_equal (method, "Get")) {
+    const gchar *name;
+    guint version;
+    g_autofree gchar *model_info = NULL;
+
+    g_variant_get (params, "(&su)", &name, &version);
+    ret = svcdb_model_get (name, version, &model_info);
+    machinelearning_service_model_complete_get (obj, invoc, model_info, ret);
+  } else if (g_str_equal (method, "GetActivated")) {
+    const gchar *name;
+    g_autofree gchar *model_info = NULL;
+
+    g_variant_get (params, "(&s)", &name);
+    ret = svcdb_model_get_activated (name, &model_info);
+    machinelearning_service_model_complete_get_activated (obj, invoc, model_info, ret);
+  } else if (g_str_equal (method, "GetAll")) {
+    const gchar *name;
+    g_autofree gchar *model_info = NULL;
+
+    g_variant_get (params, "(&s)", &name);
+    ret = svcdb_model_get_all (name, &model_info);
+    machinelearning_service_model_complete_get_all (obj, invoc, model_info, ret);
+  } else if (g_str_equal (method, "GetAllFd")) {
+    const gchar *name;
+    g_autofree gchar *model_info = NULL;
+    g_autoptr (GUnixFDList) fd_list = NULL;
+    gint fd = -1;
+    guint64 size = 0;
+
+    g_variant_get (params, "(&s)", &name);
+    ret = svcdb_model_get_all (name, &model_info);
+    if (ret == 0) {
+      size = strlen (model_info);
+      fd = gdbus_memfd_new ("ml-agent-model-info", model_info, size);
+      if (fd < 0) {
+        ret = fd;
+        size = 0;
+      }
+    }
+
+    if (fd >= 0)
+      fd_list = g_unix_fd_list_new_from_array (&fd, 1);
+
+    machinelearning_service_model_complete_get_all_fd (obj, invoc, fd_list, 0, size, ret);
+  } else if (g_str_equal (method, "List")) {
+    const gchar *filter;
+    gint active_state;
+    guint offset, limit;
+    g_autofree gchar *model_list = NULL;
+
+    g_variant_get (params, "(&siuu)", &filter, &active_state, &offset, &limit);
+    ret = svcdb_model_list (filter, active_state, offset, limit, &model_list);
+    machinelearning_service_model_complete_list (obj, invoc, model_list, ret);
+  } else if (g_str_equal (method, "Delete")) {
+    const gchar *name;
+    guint version;
+
+    g_variant_get (params, "(&su)", &name, &version);
+    ret = svcdb_model_delete (name, version);
+    machinelearning_service_model_complete_delete (obj, invoc, ret);
+  } else {
+    ml_loge ("Unknown method '%s' is dispatched, internal error?", method);
+    g_dbus_method_invocation_return_error (invoc, G_DBUS_ERROR,
+        G_DBUS_ERROR_UNKNOWN_METHOD, "Unknown method '%s'.", method);
+  }
+
+  ml_metrics_record (metric_name, g_get_monotonic_time () - metric_start);
+
+  g_object_unref (req->obj);
+  g_free (req);
+}
+
+/**
+ * @brief Hand the method invocation to the worker pool, serialized per model name.
+ * @return @c TRUE if the request is handled. FALSE if the service is not available.
+ */
+static gboolean
+_model_dispatch (MachinelearningServiceModel *obj,
+    GDBusMethodInvocation *invoc, const gchar *name)
+{
+  model_dispatch_request_s *req;
+  g_autofree gchar *key = g_strdup_printf ("model:%s", name ? name : "*");
+
+  req = g_new0 (model_dispatch_request_s, 1);
+  req->obj = (MachinelearningServiceModel *) g_object_ref (obj);
+  req->invoc = invoc;
+
+  if (gdbus_dispatch_push (key, _model_dispatch_worker, req) != 0) {
+    /* The dispatch layer is not available, handle it synchronously. */
+    _model_dispatch_worker (req);
+  }
+
+  return TRUE;
+}
+
 /**
  * @brief The callback function of Register method
  *
@@ -57,13 +240,23 @@ gdbus_cb_model_register (MachinelearningServiceModel *obj,
     GDBusMethodInvocation *invoc, const gchar *name, const gchar *path,
     const bool is_active, const gchar *description, const gchar *app_info)
 {
-  gint ret = 0;
-  guint version = 0U;
-
-  ret = svcdb_model_add (name, path, is_active, description, app_info, &version);
-  machinelearning_service_model_complete_register (obj, invoc, version, ret);
+  return _model_dispatch (obj, invoc, name);
+}
 
-  return TRUE;
+/**
+ * @brief The callback function of RegisterMany method
+ *
+ * @param obj Proxy instance.
+ * @param invoc Method invocation handle.
+ * @param models The array of models, (name, path, is_active, description, app_info).
+ * @return @c TRUE if the request is handled. FALSE if the service is not available.
+ */
+static gboolean
+gdbus_cb_model_register_many (MachinelearningServiceModel *obj,
+    GDBusMethodInvocation *invoc, GVariant *models)
+{
+  /* A batch may span several model names, serialize it with the whole interface. */
+  return _model_dispatch (obj, invoc, NULL);
 }
 
 /**
@@ -81,12 +274,7 @@ gdbus_cb_model_update_description (MachinelearningServiceModel *obj,
     GDBusMethodInvocation *invoc, const gchar *name, const guint version,
     const gchar *description)
 {
-  gint ret = 0;
-
-  ret = svcdb_model_update_description (name, version, description);
-  machinelearning_service_model_complete_update_description (obj, invoc, ret);
-
-  return TRUE;
+  return _model_dispatch (obj, invoc, name);
 }
 
 /**
@@ -102,12 +290,7 @@ static gboolean
 gdbus_cb_model_activate (MachinelearningServiceModel *obj,
     GDBusMethodInvocation *invoc, const gchar *name, const guint version)
 {
-  gint ret = 0;
-
-  ret = svcdb_model_activate (name, version);
-  machinelearning_service_model_complete_activate (obj, invoc, ret);
-
-  return TRUE;
+  return _model_dispatch (obj, invoc, name);
 }
 
 /**
@@ -122,13 +305,7 @@ static gboolean
 gdbus_cb_model_get (MachinelearningServiceModel *obj,
     GDBusMethodInvocation *invoc, const gchar *name, const guint version)
 {
-  gint ret = 0;
-  g_autofree gchar *model_info = NULL;
-
-  ret = svcdb_model_get (name, version, &model_info);
-  machinelearning_service_model_complete_get (obj, invoc, model_info, ret);
-
-  return TRUE;
+  return _model_dispatch (obj, invoc, name);
 }
 
 /**
@@ -143,13 +320,7 @@ static gboolean
 gdbus_cb_model_get_activated (MachinelearningServiceModel *obj,
     GDBusMethodInvocation *invoc, const gchar *name)
 {
-  gint ret = 0;
-  g_autofree gchar *model_info = NULL;
-
-  ret = svcdb_model_get_activated (name, &model_info);
-  machinelearning_service_model_complete_get_activated (obj, invoc, model_info, ret);
-
-  return TRUE;
+  return _model_dispatch (obj, invoc, name);
 }
 
 /**
@@ -164,13 +335,42 @@ static gboolean
 gdbus_cb_model_get_all (MachinelearningServiceModel *obj,
     GDBusMethodInvocation *invoc, const gchar *name)
 {
-  gint ret = 0;
-  g_autofree gchar *model_info = NULL;
+  return _model_dispatch (obj, invoc, name);
+}
 
-  ret = svcdb_model_get_all (name, &model_info);
-  machinelearning_service_model_complete_get_all (obj, invoc, model_info, ret);
+/**
+ * @brief The callback function of get all fd method
+ *
+ * @param obj Proxy instance.
+ * @param invoc Method invocation handle.
+ * @param fd_list The list of file descriptors received with the call.
+ * @param name The name of target model.
+ * @return @c TRUE if the request is handled. FALSE if the service is not available.
+ */
+static gboolean
+gdbus_cb_model_get_all_fd (MachinelearningServiceModel *obj,
+    GDBusMethodInvocation *invoc, GUnixFDList *fd_list, const gchar *name)
+{
+  return _model_dispatch (obj, invoc, name);
+}
 
-  return TRUE;
+/**
+ * @brief The callback function of list method
+ *
+ * @param obj Proxy instance.
+ * @param invoc Method invocation handle.
+ * @param filter The SQL LIKE pattern to match model names.
+ * @param active_state Filter on the active flag.
+ * @param offset The number of matching rows to skip.
+ * @param limit The maximum number of rows in the page.
+ * @return @c TRUE if the request is handled. FALSE if the service is not available.
+ */
+static gboolean
+gdbus_cb_model_list (MachinelearningServiceModel *obj, GDBusMethodInvocation *invoc,
+    const gchar *filter, const gint active_state, const guint offset, const guint limit)
+{
+  /* A listing spans several model names, serialize it with the whole interface. */
+  return _model_dispatch (obj, invoc, NULL);
 }
 
 /**
@@ -186,12 +386,7 @@ static gboolean
 gdbus_cb_model_delete (MachinelearningServiceModel *obj,
     GDBusMethodInvocation *invoc, const gchar *name, const guint version)
 {
-  gint ret = 0;
-
-  ret = svcdb_model_delete (name, version);
-  machinelearning_service_model_complete_delete (obj, invoc, ret);
-
-  return TRUE;
+  return _model_dispatch (obj, invoc, name);
 }
 
 /**
@@ -204,6 +399,12 @@ static struct gdbus_signal_info handler_infos[] = {
       .cb_data = NULL,
       .handler_id = 0,
   },
+  {
+      .signal_name = DBUS_MODEL_I_HANDLER_REGISTER_MANY,
+      .cb = G_CALLBACK (gdbus_cb_model_register_many),
+      .cb_data = NULL,
+      .handler_id = 0,
+  },
   {
       .signal_name = DBUS_MODEL_I_HANDLER_UPDATE_DESCRIPTION,
       .cb = G_CALLBACK (gdbus_cb_model_update_description),
@@ -234,6 +435,18 @@ static struct gdbus_signal_info handler_infos[] = {
       .cb_data = NULL,
       .handler_id = 0,
   },
+  {
+      .signal_name = DBUS_MODEL_I_HANDLER_GET_ALL_FD,
+      .cb = G_CALLBACK (gdbus_cb_model_get_all_fd),
+      .cb_data = NULL,
+      .handler_id = 0,
+  },
+  {
+      .signal_name = DBUS_MODEL_I_HANDLER_LIST,
+      .cb = G_CALLBACK (gdbus_cb_model_list),
+      .cb_data = NULL,
+      .handler_id = 0,
+  },
   {
       .signal_name = DBUS_MODEL_I_HANDLER_DELETE,
       .cb = G_CALLBACK (gdbus_cb_model_delete),
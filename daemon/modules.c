@@ -19,6 +19,23 @@
 
 static GList *module_head = NULL;
 
+/**
+ * @brief The maximum number of threads probing/initializing modules in parallel.
+ */
+#define MODULE_INIT_POOL_MAX (4)
+
+static GMutex module_failed_lock;
+static GList *module_failed_head = NULL;
+
+/**
+ * @brief Structure for one module initialization task.
+ */
+struct module_init_task
+{
+  const struct module_ops *module;
+  void *data;
+};
+
 /**
  * @brief Add the specific DBus interface into the Machine Learning agent daemon.
  */
@@ -37,31 +54,71 @@ remove_module (const struct module_ops *module)
   module_head = g_list_remove (module_head, (gconstpointer) module);
 }
 
+/**
+ * @brief Worker function to probe and initialize one module.
+ */
+static void
+init_module_worker (gpointer task_data, gpointer user_data)
+{
+  struct module_init_task *task = (struct module_init_task *) task_data;
+  const struct module_ops *module = task->module;
+
+  if (module->probe && module->probe (task->data) != 0) {
+    ml_loge ("[%s] probe fail", module->name);
+    g_mutex_lock (&module_failed_lock);
+    module_failed_head = g_list_append (module_failed_head, (gpointer) module);
+    g_mutex_unlock (&module_failed_lock);
+  } else if (module->init) {
+    module->init (task->data);
+  }
+
+  g_free (task);
+}
+
 /**
  * @brief Initialize all added modules by calling probe and init callback functions.
+ * @details The modules are independent and are probed/initialized in parallel
+ * on a small thread pool. This returns after every module has finished, so
+ * the caller can safely claim the bus name afterwards.
  */
 void
 init_modules (void *data)
 {
-  GList *elem, *elem_n;
+  GList *elem;
   const struct module_ops *module;
+  GThreadPool *pool;
+  guint num_modules = g_list_length (module_head);
 
-  elem = module_head;
-  while (elem != NULL) {
-    module = elem->data;
-    elem_n = elem->next;
+  if (num_modules == 0)
+    return;
+
+  pool = g_thread_pool_new (init_module_worker, NULL,
+      MIN (num_modules, MODULE_INIT_POOL_MAX), FALSE, NULL);
 
-    if (module->probe && module->probe (data) != 0) {
-      ml_loge ("[%s] probe fail", module->name);
-      module_head = g_list_remove (module_head, (gconstpointer) module);
-      elem = elem_n;
-      continue;
+  for (elem = module_head; elem != NULL; elem = elem->next) {
+    struct module_init_task *task;
+
+    task = g_new0 (struct module_init_task, 1);
+    task->module = elem->data;
+    task->data = data;
+
+    if (!pool || !g_thread_pool_push (pool, task, NULL)) {
+      /* The pool is not available, initialize this module in place. */
+      init_module_worker (task, NULL);
     }
+  }
 
-    if (module->init)
-      module->init (data);
-    elem = elem_n;
+  /* Wait until every module finishes its probe/init. */
+  if (pool)
+    g_thread_pool_free (pool, FALSE, TRUE);
+
+  for (elem = module_failed_head; elem != NULL; elem = elem->next) {
+    module = elem->data;
+    module_head = g_list_remove (module_head, (gconstpointer) module);
   }
+
+  g_list_free (module_failed_head);
+  module_failed_head = NULL;
 }
 
 /**
@@ -14,23 +14,52 @@
  * @details   This implements the pipeline dbus interface.
  */
 
+#include <gio/gunixfdlist.h>
 #include <glib.h>
 #include <gst/gst.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "common.h"
 #include "dbus-interface.h"
+#include "event-util.h"
 #include "gdbus-util.h"
 #include "log.h"
+#include "metrics-util.h"
 #include "modules.h"
 #include "pipeline-dbus.h"
 #include "service-db-util.h"
 
 static MachinelearningServicePipeline *g_gdbus_instance = NULL;
 static GHashTable *pipeline_table = NULL;
-G_LOCK_DEFINE_STATIC (pipeline_table_lock);
+static GRWLock pipeline_table_lock;
+
+/**
+ * @brief The maximum number of worker threads to launch pipelines.
+ */
+#define LAUNCH_THREAD_POOL_MAX (4)
+
+static GThreadPool *launch_thread_pool = NULL;
+
+/**
+ * @brief The default seconds an idle warm pipeline is kept before eviction.
+ * It can be overridden with the ML_AGENT_WARM_PIPELINE_TIMEOUT environment variable.
+ */
+#define WARM_PIPELINE_TIMEOUT_DEFAULT (60)
+
+/**
+ * @brief The interval of the warm-pool eviction check in seconds.
+ */
+#define WARM_PIPELINE_EVICT_INTERVAL (10U)
+
+/**
+ * @brief Warm pool of pre-parsed pipelines held in PAUSED, keyed by service name.
+ * It shares pipeline_table_lock with the pipeline table.
+ */
+static GHashTable *warm_pool = NULL;
+static guint warm_pool_timer_id = 0;
 
 /**
  * @brief Structure for pipeline.
@@ -41,6 +70,9 @@ typedef struct _pipeline {
   GMutex lock;
   gchar *service_name;
   gchar *description;
+  gint last_state; /**< Last-known GstState, updated by the bus watch. Read/written atomically. */
+  guint bus_watch_id;
+  gint64 warm_since; /**< Monotonic time the pipeline entered the warm pool, for eviction. */
 } pipeline_s;
 
 /**
@@ -58,6 +90,9 @@ _pipeline_free (gpointer data)
 
   p = (pipeline_s *) data;
 
+  if (p->bus_watch_id > 0)
+    g_source_remove (p->bus_watch_id);
+
   if (p->element)
     gst_object_unref (p->element);
 
@@ -93,10 +128,12 @@ static gboolean
 dbus_cb_core_set_pipeline (MachinelearningServicePipeline *obj, GDBusMethodInvocation *invoc,
     const gchar *service_name, const gchar *pipeline_desc, gpointer user_data)
 {
+  gint64 metric_start = g_get_monotonic_time ();
   gint result = 0;
 
   result = svcdb_pipeline_set (service_name, pipeline_desc);
   machinelearning_service_pipeline_complete_set_pipeline (obj, invoc, result);
+  ml_metrics_record ("dbus.pipeline.SetPipeline", g_get_monotonic_time () - metric_start);
 
   return TRUE;
 }
@@ -108,11 +145,50 @@ static gboolean
 dbus_cb_core_get_pipeline (MachinelearningServicePipeline *obj,
     GDBusMethodInvocation *invoc, const gchar *service_name, gpointer user_data)
 {
+  gint64 metric_start = g_get_monotonic_time ();
   gint result = 0;
   g_autofree gchar *desc = NULL;
 
   result = svcdb_pipeline_get (service_name, &desc);
   machinelearning_service_pipeline_complete_get_pipeline (obj, invoc, result, desc);
+  ml_metrics_record ("dbus.pipeline.GetPipeline", g_get_monotonic_time () - metric_start);
+
+  return TRUE;
+}
+
+/**
+ * @brief Get the pipeline description of the given service over a sealed memfd.
+ * @details Large descriptions travel as a file descriptor instead of a bus
+ * string argument, so the bus daemon stays out of the data path.
+ */
+static gboolean
+dbus_cb_core_get_pipeline_fd (MachinelearningServicePipeline *obj,
+    GDBusMethodInvocation *invoc, GUnixFDList *fd_list_in,
+    const gchar *service_name, gpointer user_data)
+{
+  gint64 metric_start = g_get_monotonic_time ();
+  gint result = 0;
+  gint fd = -1;
+  guint64 size = 0;
+  g_autofree gchar *desc = NULL;
+  g_autoptr (GUnixFDList) fd_list = NULL;
+
+  result = svcdb_pipeline_get (service_name, &desc);
+  if (result == 0) {
+    size = strlen (desc);
+    fd = gdbus_memfd_new ("ml-agent-pipeline-desc", desc, size);
+    if (fd < 0) {
+      result = fd;
+      size = 0;
+    }
+  }
+
+  if (fd >= 0)
+    fd_list = g_unix_fd_list_new_from_array (&fd, 1);
+
+  machinelearning_service_pipeline_complete_get_pipeline_fd (
+      obj, invoc, fd_list, 0, size, result);
+  ml_metrics_record ("dbus.pipeline.GetPipelineFd", g_get_monotonic_time () - metric_start);
 
   return TRUE;
 }
@@ -124,35 +200,174 @@ static gboolean
 dbus_cb_core_delete_pipeline (MachinelearningServicePipeline *obj,
     GDBusMethodInvocation *invoc, const gchar *service_name, gpointer user_data)
 {
+  gint64 metric_start = g_get_monotonic_time ();
   gint result = 0;
 
   result = svcdb_pipeline_delete (service_name);
   machinelearning_service_pipeline_complete_delete_pipeline (obj, invoc, result);
+  ml_metrics_record ("dbus.pipeline.DeletePipeline", g_get_monotonic_time () - metric_start);
 
   return TRUE;
 }
 
 /**
- * @brief Launch the pipeline with given description. Return the call result and its id.
+ * @brief Structure for the asynchronous launch request.
+ */
+typedef struct _pipeline_launch_request {
+  MachinelearningServicePipeline *obj;
+  GDBusMethodInvocation *invoc;
+  gchar *service_name;
+  gboolean prewarm;
+} pipeline_launch_request_s;
+
+/**
+ * @brief Get the idle timeout of warm pipelines in seconds.
+ */
+static gint64
+_warm_pipeline_timeout (void)
+{
+  static gsize initialized = 0;
+  static gint64 timeout = WARM_PIPELINE_TIMEOUT_DEFAULT;
+
+  if (g_once_init_enter (&initialized)) {
+    const gchar *env = g_getenv ("ML_AGENT_WARM_PIPELINE_TIMEOUT");
+
+    if (env) {
+      gint64 value = g_ascii_strtoll (env, NULL, 10);
+
+      if (value > 0)
+        timeout = value;
+    }
+    g_once_init_leave (&initialized, 1);
+  }
+
+  return timeout;
+}
+
+/**
+ * @brief Timeout callback to release the warm pipelines idle for too long.
  */
 static gboolean
-dbus_cb_core_launch_pipeline (MachinelearningServicePipeline *obj,
-    GDBusMethodInvocation *invoc, const gchar *service_name, gpointer user_data)
+_warm_pool_evict_cb (gpointer user_data)
+{
+  GHashTableIter iter;
+  gpointer key, value;
+  gint64 deadline = g_get_monotonic_time () - _warm_pipeline_timeout () * G_USEC_PER_SEC;
+
+  g_rw_lock_writer_lock (&pipeline_table_lock);
+  if (warm_pool) {
+    g_hash_table_iter_init (&iter, warm_pool);
+    while (g_hash_table_iter_next (&iter, &key, &value)) {
+      pipeline_s *p = (pipeline_s *) value;
+
+      if (p->warm_since < deadline) {
+        ml_logi ("The warm pipeline of '%s' has been idle, release it.", p->service_name);
+        g_hash_table_iter_remove (&iter);
+      }
+    }
+  }
+  g_rw_lock_writer_unlock (&pipeline_table_lock);
+
+  return G_SOURCE_CONTINUE;
+}
+
+/**
+ * @brief Initialize GStreamer once, on the first pipeline launch.
+ * @details Registry loading is the largest chunk of the daemon startup time,
+ * so it is deferred until a pipeline is actually launched.
+ */
+static void
+_ensure_gst_initialized (void)
+{
+  static gsize gst_initialized = 0;
+
+  if (g_once_init_enter (&gst_initialized)) {
+    GError *err = NULL;
+
+    if (!gst_init_check (NULL, NULL, &err))
+      ml_loge ("Failed to initialize GStreamer: %s", (err ? err->message : "Unknown error"));
+
+    g_clear_error (&err);
+    g_once_init_leave (&gst_initialized, 1);
+  }
+}
+
+/**
+ * @brief Bus callback to track the state of the pipeline.
+ * @details Caching the state on state-changed messages keeps the GetState
+ * method out of the GStreamer core, so periodic state polls neither contend
+ * with start/stop nor block on an async state change.
+ */
+static gboolean
+_pipeline_bus_cb (GstBus *bus, GstMessage *message, gpointer user_data)
+{
+  pipeline_s *p = (pipeline_s *) user_data;
+
+  if (GST_MESSAGE_TYPE (message) == GST_MESSAGE_STATE_CHANGED
+      && GST_MESSAGE_SRC (message) == GST_OBJECT_CAST (p->element)) {
+    GstState new_state = GST_STATE_NULL;
+
+    gst_message_parse_state_changed (message, NULL, &new_state, NULL);
+    g_atomic_int_set (&p->last_state, (gint) new_state);
+
+    /* Publish the transition, subscribers read it from shared memory. */
+    ml_event_publish (ML_EVENT_PIPELINE_STATE, p->id, (gint) new_state, 0U,
+        p->service_name);
+    if (g_gdbus_instance)
+      machinelearning_service_pipeline_emit_changed (g_gdbus_instance);
+  }
+
+  return G_SOURCE_CONTINUE;
+}
+
+/**
+ * @brief Worker function to parse and pre-roll the pipeline off the main loop.
+ * @details The method invocation is completed here, from the worker thread,
+ * so slow-loading pipelines do not block the other clients' method calls.
+ * It serves both launch and prewarm requests; a pipeline prepared by a prewarm
+ * request goes to the warm pool and a later launch request takes it over.
+ */
+static void
+_launch_pipeline_worker (gpointer data, gpointer user_data)
 {
+  gint64 metric_start = g_get_monotonic_time ();
+  pipeline_launch_request_s *req = (pipeline_launch_request_s *) data;
+  const gchar *service_name = req->service_name;
   gint result = 0;
   gint64 id = -1;
   GError *err = NULL;
   GstStateChangeReturn sc_ret;
   GstElement *pipeline = NULL;
-  pipeline_s *p;
+  pipeline_s *p = NULL;
   g_autofree gchar *desc = NULL;
 
+  /* A launch request takes over a matching warm pipeline instead of parsing. */
+  if (!req->prewarm) {
+    gpointer stolen_key = NULL;
+    gpointer stolen_value = NULL;
+
+    g_rw_lock_writer_lock (&pipeline_table_lock);
+    if (warm_pool
+        && g_hash_table_steal_extended (warm_pool, service_name, &stolen_key, &stolen_value)) {
+      p = (pipeline_s *) stolen_value;
+      id = p->id = g_get_monotonic_time ();
+      g_hash_table_insert (pipeline_table, GINT_TO_POINTER (p->id), p);
+    }
+    g_rw_lock_writer_unlock (&pipeline_table_lock);
+    g_free (stolen_key);
+
+    if (p)
+      goto out;
+  }
+
   result = svcdb_pipeline_get (service_name, &desc);
   if (result != 0) {
     ml_loge ("Failed to launch pipeline of '%s'.", service_name);
-    goto error;
+    goto out;
   }
 
+  _ensure_gst_initialized ();
+
   pipeline = gst_parse_launch (desc, &err);
   if (!pipeline || err) {
     ml_loge ("Failed to launch pipeline '%s' (error msg: %s).",
@@ -163,7 +378,7 @@ dbus_cb_core_launch_pipeline (MachinelearningServicePipeline *obj,
       gst_object_unref (pipeline);
 
     result = -ESTRPIPE;
-    goto error;
+    goto out;
   }
 
   /** now set pipeline as paused state */
@@ -174,7 +389,7 @@ dbus_cb_core_launch_pipeline (MachinelearningServicePipeline *obj,
 
     gst_object_unref (pipeline);
     result = -ESTRPIPE;
-    goto error;
+    goto out;
   }
 
   /** now fill the struct and store into hash table */
@@ -184,13 +399,107 @@ dbus_cb_core_launch_pipeline (MachinelearningServicePipeline *obj,
   p->service_name = g_strdup (service_name);
   g_mutex_init (&p->lock);
 
-  G_LOCK (pipeline_table_lock);
-  id = p->id = g_get_monotonic_time ();
-  g_hash_table_insert (pipeline_table, GINT_TO_POINTER (p->id), p);
-  G_UNLOCK (pipeline_table_lock);
+  {
+    GstBus *bus = gst_element_get_bus (pipeline);
+
+    if (bus) {
+      p->bus_watch_id = gst_bus_add_watch (bus, _pipeline_bus_cb, p);
+      gst_object_unref (bus);
+    }
+  }
+  g_atomic_int_set (&p->last_state, (gint) GST_STATE (pipeline));
+
+  g_rw_lock_writer_lock (&pipeline_table_lock);
+  if (req->prewarm) {
+    /* An existing warm entry of the service is replaced and freed. */
+    p->warm_since = g_get_monotonic_time ();
+    g_hash_table_insert (warm_pool, g_strdup (service_name), p);
+  } else {
+    id = p->id = g_get_monotonic_time ();
+    g_hash_table_insert (pipeline_table, GINT_TO_POINTER (p->id), p);
+  }
+  g_rw_lock_writer_unlock (&pipeline_table_lock);
+
+out:
+  if (req->prewarm) {
+    machinelearning_service_pipeline_complete_prewarm_pipeline (req->obj, req->invoc, result);
+    ml_metrics_record ("dbus.pipeline.PrewarmPipeline", g_get_monotonic_time () - metric_start);
+  } else {
+    machinelearning_service_pipeline_complete_launch_pipeline (req->obj, req->invoc, result, id);
+    ml_metrics_record ("dbus.pipeline.LaunchPipeline", g_get_monotonic_time () - metric_start);
+  }
+
+  g_object_unref (req->obj);
+  g_free (req->service_name);
+  g_free (req);
+}
+
+/**
+ * @brief Launch the pipeline with given description. Return the call result and its id.
+ * @details The invocation is completed asynchronously when the worker thread
+ * finishes parsing and pre-rolling the pipeline.
+ */
+static gboolean
+dbus_cb_core_launch_pipeline (MachinelearningServicePipeline *obj,
+    GDBusMethodInvocation *invoc, const gchar *service_name, gpointer user_data)
+{
+  pipeline_launch_request_s *req;
+
+  req = g_new0 (pipeline_launch_request_s, 1);
+  req->obj = (MachinelearningServicePipeline *) g_object_ref (obj);
+  req->invoc = invoc;
+  req->service_name = g_strdup (service_name);
+
+  if (!g_thread_pool_push (launch_thread_pool, req, NULL)) {
+    /* The pool failed to queue the request, launch it synchronously. */
+    _launch_pipeline_worker (req, NULL);
+  }
+
+  return TRUE;
+}
+
+/**
+ * @brief Parse the stored pipeline ahead of time and hold it in the warm pool. Return the call result.
+ * @details A warm pipeline is already parsed and pre-rolled in PAUSED, so a
+ * later launch request only takes it over and a start request flips it to
+ * PLAYING. Warm pipelines idle for longer than the configurable timeout are
+ * released by the eviction timer.
+ */
+static gboolean
+dbus_cb_core_prewarm_pipeline (MachinelearningServicePipeline *obj,
+    GDBusMethodInvocation *invoc, const gchar *service_name, gpointer user_data)
+{
+  pipeline_launch_request_s *req;
+  pipeline_s *p = NULL;
+
+  /* The service is already warm, only refresh its idle clock. */
+  g_rw_lock_writer_lock (&pipeline_table_lock);
+  if (warm_pool)
+    p = (pipeline_s *) g_hash_table_lookup (warm_pool, service_name);
+  if (p)
+    p->warm_since = g_get_monotonic_time ();
+  g_rw_lock_writer_unlock (&pipeline_table_lock);
+
+  if (p) {
+    machinelearning_service_pipeline_complete_prewarm_pipeline (obj, invoc, 0);
+    return TRUE;
+  }
+
+  if (warm_pool_timer_id == 0) {
+    warm_pool_timer_id = g_timeout_add_seconds (
+        WARM_PIPELINE_EVICT_INTERVAL, _warm_pool_evict_cb, NULL);
+  }
+
+  req = g_new0 (pipeline_launch_request_s, 1);
+  req->obj = (MachinelearningServicePipeline *) g_object_ref (obj);
+  req->invoc = invoc;
+  req->service_name = g_strdup (service_name);
+  req->prewarm = TRUE;
 
-error:
-  machinelearning_service_pipeline_complete_launch_pipeline (obj, invoc, result, id);
+  if (!g_thread_pool_push (launch_thread_pool, req, NULL)) {
+    /* The pool failed to queue the request, prepare it synchronously. */
+    _launch_pipeline_worker (req, NULL);
+  }
 
   return TRUE;
 }
@@ -202,20 +511,21 @@ static gboolean
 dbus_cb_core_start_pipeline (MachinelearningServicePipeline *obj,
     GDBusMethodInvocation *invoc, gint64 id, gpointer user_data)
 {
+  gint64 metric_start = g_get_monotonic_time ();
   gint result = 0;
   GstStateChangeReturn sc_ret;
   pipeline_s *p = NULL;
 
-  G_LOCK (pipeline_table_lock);
+  g_rw_lock_reader_lock (&pipeline_table_lock);
   p = (pipeline_s *) g_hash_table_lookup (pipeline_table, GINT_TO_POINTER (id));
 
   if (!p) {
     ml_loge ("The callback start_pipeline is called, but there is no pipeline matched with ID.");
-    G_UNLOCK (pipeline_table_lock);
+    g_rw_lock_reader_unlock (&pipeline_table_lock);
     result = -EINVAL;
   } else {
     g_mutex_lock (&p->lock);
-    G_UNLOCK (pipeline_table_lock);
+    g_rw_lock_reader_unlock (&pipeline_table_lock);
     sc_ret = gst_element_set_state (p->element, GST_STATE_PLAYING);
     g_mutex_unlock (&p->lock);
 
@@ -227,6 +537,7 @@ dbus_cb_core_start_pipeline (MachinelearningServicePipeline *obj,
   }
 
   machinelearning_service_pipeline_complete_start_pipeline (obj, invoc, result);
+  ml_metrics_record ("dbus.pipeline.StartPipeline", g_get_monotonic_time () - metric_start);
 
   return TRUE;
 }
@@ -238,20 +549,21 @@ static gboolean
 dbus_cb_core_stop_pipeline (MachinelearningServicePipeline *obj,
     GDBusMethodInvocation *invoc, gint64 id, gpointer user_data)
 {
+  gint64 metric_start = g_get_monotonic_time ();
   gint result = 0;
   GstStateChangeReturn sc_ret;
   pipeline_s *p = NULL;
 
-  G_LOCK (pipeline_table_lock);
+  g_rw_lock_reader_lock (&pipeline_table_lock);
   p = (pipeline_s *) g_hash_table_lookup (pipeline_table, GINT_TO_POINTER (id));
 
   if (!p) {
     ml_loge ("The callback stop_pipeline is called, but there is no pipeline matched with ID.");
-    G_UNLOCK (pipeline_table_lock);
+    g_rw_lock_reader_unlock (&pipeline_table_lock);
     result = -EINVAL;
   } else {
     g_mutex_lock (&p->lock);
-    G_UNLOCK (pipeline_table_lock);
+    g_rw_lock_reader_unlock (&pipeline_table_lock);
     sc_ret = gst_element_set_state (p->element, GST_STATE_PAUSED);
     g_mutex_unlock (&p->lock);
 
@@ -263,6 +575,7 @@ dbus_cb_core_stop_pipeline (MachinelearningServicePipeline *obj,
   }
 
   machinelearning_service_pipeline_complete_stop_pipeline (obj, invoc, result);
+  ml_metrics_record ("dbus.pipeline.StopPipeline", g_get_monotonic_time () - metric_start);
 
   return TRUE;
 }
@@ -274,16 +587,23 @@ static gboolean
 dbus_cb_core_destroy_pipeline (MachinelearningServicePipeline *obj,
     GDBusMethodInvocation *invoc, gint64 id, gpointer user_data)
 {
+  gint64 metric_start = g_get_monotonic_time ();
   gint result = 0;
   pipeline_s *p = NULL;
 
-  G_LOCK (pipeline_table_lock);
+  g_rw_lock_writer_lock (&pipeline_table_lock);
   p = (pipeline_s *) g_hash_table_lookup (pipeline_table, GINT_TO_POINTER (id));
 
   if (!p) {
     ml_loge ("The callback destroy_pipeline is called, but there is no pipeline matched with ID.");
     result = -EINVAL;
   } else {
+    g_hash_table_steal (pipeline_table, GINT_TO_POINTER (id));
+  }
+
+  g_rw_lock_writer_unlock (&pipeline_table_lock);
+
+  if (p) {
     /**
      * @todo Fix hanging issue when trying to set GST_STATE_NULL state for pipelines
      * containing tensor_query_*. As a workaround, just unref the pipeline instance.
@@ -299,50 +619,47 @@ dbus_cb_core_destroy_pipeline (MachinelearningServicePipeline *obj,
      *     result = -ESTRPIPE;
      *   }
      */
-    g_hash_table_remove (pipeline_table, GINT_TO_POINTER (id));
+
+    /* Wait until the in-flight state operation on this pipeline finishes. */
+    g_mutex_lock (&p->lock);
+    g_mutex_unlock (&p->lock);
+    _pipeline_free (p);
   }
 
-  G_UNLOCK (pipeline_table_lock);
   machinelearning_service_pipeline_complete_destroy_pipeline (obj, invoc, result);
+  ml_metrics_record ("dbus.pipeline.DestroyPipeline", g_get_monotonic_time () - metric_start);
 
   return TRUE;
 }
 
 /**
  * @brief Get the state of pipeline with given id. Return the call result and its state.
+ * @details The state cached by the bus watch is returned, so the query never
+ * takes the pipeline's mutex and never enters the GStreamer core.
  */
 static gboolean
 dbus_cb_core_get_state (MachinelearningServicePipeline *obj,
     GDBusMethodInvocation *invoc, gint64 id, gpointer user_data)
 {
+  gint64 metric_start = g_get_monotonic_time ();
   gint result = 0;
-  GstStateChangeReturn sc_ret;
   GstState state = GST_STATE_NULL;
   pipeline_s *p = NULL;
 
-  G_LOCK (pipeline_table_lock);
+  g_rw_lock_reader_lock (&pipeline_table_lock);
   p = (pipeline_s *) g_hash_table_lookup (pipeline_table, GINT_TO_POINTER (id));
 
+  if (p)
+    state = (GstState) g_atomic_int_get (&p->last_state);
+  g_rw_lock_reader_unlock (&pipeline_table_lock);
+
   if (!p) {
     ml_loge ("The callback get_state is called, but there is no pipeline matched with ID.");
     result = -EINVAL;
-    machinelearning_service_pipeline_complete_get_state (obj, invoc, result, (gint) state);
-    G_UNLOCK (pipeline_table_lock);
-    return TRUE;
-  }
-
-  g_mutex_lock (&p->lock);
-  G_UNLOCK (pipeline_table_lock);
-  sc_ret = gst_element_get_state (p->element, &state, NULL, GST_MSECOND);
-  g_mutex_unlock (&p->lock);
-
-  if (sc_ret == GST_STATE_CHANGE_FAILURE) {
-    ml_loge ("Failed to get the state of the pipline whose service name is %s.",
-        p->service_name);
-    result = -ESTRPIPE;
   }
 
   machinelearning_service_pipeline_complete_get_state (obj, invoc, result, (gint) state);
+  ml_metrics_record ("dbus.pipeline.GetState", g_get_monotonic_time () - metric_start);
 
   return TRUE;
 }
@@ -360,6 +677,12 @@ static struct gdbus_signal_info handler_infos[] = {
       .cb_data = NULL,
       .handler_id = 0,
   },
+  {
+      .signal_name = DBUS_PIPELINE_I_GET_FD_HANDLER,
+      .cb = G_CALLBACK (dbus_cb_core_get_pipeline_fd),
+      .cb_data = NULL,
+      .handler_id = 0,
+  },
   {
       .signal_name = DBUS_PIPELINE_I_DELETE_HANDLER,
       .cb = G_CALLBACK (dbus_cb_core_delete_pipeline),
@@ -372,6 +695,12 @@ static struct gdbus_signal_info handler_infos[] = {
       .cb_data = NULL,
       .handler_id = 0,
   },
+  {
+      .signal_name = DBUS_PIPELINE_I_PREWARM_HANDLER,
+      .cb = G_CALLBACK (dbus_cb_core_prewarm_pipeline),
+      .cb_data = NULL,
+      .handler_id = 0,
+  },
   {
       .signal_name = DBUS_PIPELINE_I_START_HANDLER,
       .cb = G_CALLBACK (dbus_cb_core_start_pipeline),
@@ -445,10 +774,16 @@ init_pipeline_module (void *data)
 {
   gdbus_initialize ();
 
-  G_LOCK (pipeline_table_lock);
+  g_rw_lock_writer_lock (&pipeline_table_lock);
   g_assert (NULL == pipeline_table); /** Internal error */
   pipeline_table = g_hash_table_new_full (g_direct_hash, g_direct_equal, NULL, _pipeline_free);
-  G_UNLOCK (pipeline_table_lock);
+  g_assert (NULL == warm_pool); /** Internal error */
+  warm_pool = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, _pipeline_free);
+  g_rw_lock_writer_unlock (&pipeline_table_lock);
+
+  g_assert (NULL == launch_thread_pool); /** Internal error */
+  launch_thread_pool = g_thread_pool_new (
+      _launch_pipeline_worker, NULL, LAUNCH_THREAD_POOL_MAX, FALSE, NULL);
 }
 
 /**
@@ -457,11 +792,25 @@ init_pipeline_module (void *data)
 static void
 exit_pipeline_module (void *data)
 {
-  G_LOCK (pipeline_table_lock);
+  if (launch_thread_pool) {
+    /* Wait until the queued launch requests are completed. */
+    g_thread_pool_free (launch_thread_pool, FALSE, TRUE);
+    launch_thread_pool = NULL;
+  }
+
+  if (warm_pool_timer_id > 0) {
+    g_source_remove (warm_pool_timer_id);
+    warm_pool_timer_id = 0;
+  }
+
+  g_rw_lock_writer_lock (&pipeline_table_lock);
   g_assert (pipeline_table); /** Internal error */
   g_hash_table_destroy (pipeline_table);
   pipeline_table = NULL;
-  G_UNLOCK (pipeline_table_lock);
+  g_assert (warm_pool); /** Internal error */
+  g_hash_table_destroy (warm_pool);
+  warm_pool = NULL;
+  g_rw_lock_writer_unlock (&pipeline_table_lock);
 
   gdbus_disconnect_signal (g_gdbus_instance, ARRAY_SIZE (handler_infos), handler_infos);
   gdbus_put_pipeline_instance (&g_gdbus_instance);
@@ -66,11 +66,16 @@ _get_app_info (const gchar *package_name, const gchar *res_type, const gchar *re
 
 /**
  * @brief Parse json and update ml-service database.
+ * @details Model and resource entries are not applied here but collected into
+ * @a builder, the caller commits each group with a single batch call.
+ * @return The number of entries collected into @a builder.
  */
-static void
-_parse_json (const gchar *json_path, mlsvc_json_type_e json_type, const gchar *app_info)
+static guint
+_parse_json (const gchar *json_path, mlsvc_json_type_e json_type,
+    const gchar *app_info, GVariantBuilder *builder)
 {
   g_autofree gchar *json_file = NULL;
+  guint collected = 0U;
   gint ret;
 
   switch (json_type) {
@@ -85,13 +90,13 @@ _parse_json (const gchar *json_path, mlsvc_json_type_e json_type, const gchar *a
       break;
     default:
       ml_loge ("Unknown data type '%d', internal error?", json_type);
-      return;
+      return 0U;
   }
 
   if (!g_file_test (json_file, (GFileTest) (G_FILE_TEST_EXISTS | G_FILE_TEST_IS_REGULAR))) {
     ml_logw ("Failed to find json file '%s'. RPK using ML Service API should provide this json file.",
         json_file);
-    return;
+    return 0U;
   }
 
   g_autoptr (JsonParser) parser = json_parser_new ();
@@ -100,7 +105,7 @@ _parse_json (const gchar *json_path, mlsvc_json_type_e json_type, const gchar *a
   json_parser_load_from_file (parser, json_file, &err);
   if (err) {
     ml_loge ("Failed to parse json file '%s': %s", json_file, err->message);
-    return;
+    return 0U;
   }
 
   JsonNode *root = json_parser_get_root (parser);
@@ -112,7 +117,7 @@ _parse_json (const gchar *json_path, mlsvc_json_type_e json_type, const gchar *a
     array = json_node_get_array (root);
     if (!array) {
       ml_loge ("Failed to get root array from json file '%s'", json_file);
-      return;
+      return 0U;
     }
 
     json_len = json_array_get_length (array);
@@ -139,7 +144,6 @@ _parse_json (const gchar *json_path, mlsvc_json_type_e json_type, const gchar *a
             continue;
           }
 
-          guint version;
           bool active = (activate && g_ascii_strcasecmp (activate, "true") == 0);
           bool clear_old = (clear && g_ascii_strcasecmp (clear, "true") == 0);
 
@@ -149,13 +153,9 @@ _parse_json (const gchar *json_path, mlsvc_json_type_e json_type, const gchar *a
             svcdb_model_delete (name, 0U);
           }
 
-          ret = svcdb_model_add (name, model, active, desc ? desc : "",
-              app_info ? app_info : "", &version);
-
-          if (ret == 0)
-            ml_logi ("The model with name '%s' is registered as version '%u'.", name, version);
-          else
-            ml_loge ("Failed to register the model with name '%s'.", name);
+          g_variant_builder_add (builder, "(ssbss)", name, model,
+              (gboolean) active, desc ? desc : "", app_info ? app_info : "");
+          collected++;
         }
         break;
       case MLSVC_JSON_PIPELINE:
@@ -196,12 +196,9 @@ _parse_json (const gchar *json_path, mlsvc_json_type_e json_type, const gchar *a
             svcdb_resource_delete (name);
           }
 
-          ret = svcdb_resource_add (name, path, desc ? desc : "", app_info ? app_info : "");
-
-          if (ret == 0)
-            ml_logi ("The resource with name '%s' is registered.", name);
-          else
-            ml_loge ("Failed to register the resource with name '%s'.", name);
+          g_variant_builder_add (builder, "(ssss)", name, path,
+              desc ? desc : "", app_info ? app_info : "");
+          collected++;
         }
         break;
       default:
@@ -209,6 +206,8 @@ _parse_json (const gchar *json_path, mlsvc_json_type_e json_type, const gchar *a
         break;
     }
   }
+
+  return collected;
 }
 
 /**
@@ -317,8 +316,40 @@ _pkg_mgr_event_cb (const char *type, const char *package_name,
     g_autofree gchar *app_info = _get_app_info (package_name, res_type, res_version);
     g_autofree gchar *json_path = g_build_filename (pkg_path, res_type, NULL);
 
-    for (gint t = MLSVC_JSON_MODEL; t < MLSVC_JSON_MAX; t++)
-      _parse_json (json_path, (mlsvc_json_type_e) t, app_info);
+    /**
+     * Collect the model and resource rows first, then commit each group with
+     * a single batch call. The group pays one journal flush and the database
+     * lock is never released while a transaction is open.
+     */
+    GVariantBuilder model_builder, res_builder;
+    g_variant_builder_init (&model_builder, G_VARIANT_TYPE ("a(ssbss)"));
+    g_variant_builder_init (&res_builder, G_VARIANT_TYPE ("a(ssss)"));
+
+    guint n_models = _parse_json (json_path, MLSVC_JSON_MODEL, app_info, &model_builder);
+    _parse_json (json_path, MLSVC_JSON_PIPELINE, app_info, NULL);
+    guint n_res = _parse_json (json_path, MLSVC_JSON_RESOURCE, app_info, &res_builder);
+
+    g_autoptr (GVariant) models = g_variant_ref_sink (g_variant_builder_end (&model_builder));
+    g_autoptr (GVariant) resources = g_variant_ref_sink (g_variant_builder_end (&res_builder));
+
+    if (n_models > 0U) {
+      GVariant *versions = NULL;
+
+      if (svcdb_model_add_many (models, &versions) == 0)
+        ml_logi ("Registered %u models of package %s.", n_models, package_name);
+      else
+        ml_loge ("Failed to register the models of package %s.", package_name);
+
+      if (versions)
+        g_variant_unref (g_variant_ref_sink (versions));
+    }
+
+    if (n_res > 0U) {
+      if (svcdb_resource_add_many (resources) == 0)
+        ml_logi ("Registered %u resources of package %s.", n_res, package_name);
+      else
+        ml_loge ("Failed to register the resources of package %s.", package_name);
+    }
   } else if (event_type == PACKAGE_MANAGER_EVENT_TYPE_UNINSTALL
              && event_state == PACKAGE_MANAGER_EVENT_STATE_STARTED) {
     ml_logi ("resource package %s is being uninstalled", package_name);
@@ -17,6 +17,7 @@
 #include "dbus-interface.h"
 #include "gdbus-util.h"
 #include "log.h"
+#include "metrics-util.h"
 #include "modules.h"
 #include "resource-dbus.h"
 #include "service-db-util.h"
@@ -41,6 +42,91 @@ gdbus_put_resource_instance (MachinelearningServiceResource **instance)
   g_clear_object (instance);
 }
 
+/**
+ * @brief Structure for the dispatched method invocation.
+ */
+typedef struct _resource_dispatch_request {
+  MachinelearningServiceResource *obj;
+  GDBusMethodInvocation *invoc;
+} resource_dispatch_request_s;
+
+/**
+ * @brief Worker function to handle one method invocation of the Resource interface.
+ * @details The method arguments are re-extracted from the invocation handle,
+ * which stays alive until the invocation is completed.
+ */
+static void
+_resource_dispatch_worker (gpointer data)
+{
+  resource_dispatch_request_s *req = (resource_dispatch_request_s *) data;
+  MachinelearningServiceResource *obj = req->obj;
+  GDBusMethodInvocation *invoc = req->invoc;
+  const gchar *method = g_dbus_method_invocation_get_method_name (invoc);
+  GVariant *params = g_dbus_method_invocation_get_parameters (invoc);
+  g_autofree gchar *metric_name = g_strdup_printf ("dbus.resource.%s", method);
+  gint64 metric_start = g_get_monotonic_time ();
+  gint ret = 0;
+
+  if (g_str_equal (method, "Add")) {
+    const gchar *name, *path, *description, *app_info;
+
+    g_variant_get (params, "(&s&s&s&s)", &name, &path, &description, &app_info);
+    ret = svcdb_resource_add (name, path, description, app_info);
+    machinelearning_service_resource_complete_add (obj, invoc, ret);
+  } else if (g_str_equal (method, "AddMany")) {
+    g_autoptr (GVariant) resources = NULL;
+
+    g_variant_get (params, "(@a(ssss))", &resources);
+    ret = svcdb_resource_add_many (resources);
+    machinelearning_service_resource_complete_add_many (obj, invoc, ret);
+  } else if (g_str_equal (method, "Get")) {
+    const gchar *name;
+    g_autofree gchar *res_info = NULL;
+
+    g_variant_get (params, "(&s)", &name);
+    ret = svcdb_resource_get (name, &res_info);
+    machinelearning_service_resource_complete_get (obj, invoc, res_info, ret);
+  } else if (g_str_equal (method, "Delete")) {
+    const gchar *name;
+
+    g_variant_get (params, "(&s)", &name);
+    ret = svcdb_resource_delete (name);
+    machinelearning_service_resource_complete_delete (obj, invoc, ret);
+  } else {
+    ml_loge ("Unknown method '%s' is dispatched, internal error?", method);
+    g_dbus_method_invocation_return_error (invoc, G_DBUS_ERROR,
+        G_DBUS_ERROR_UNKNOWN_METHOD, "Unknown method '%s'.", method);
+  }
+
+  ml_metrics_record (metric_name, g_get_monotonic_time () - metric_start);
+
+  g_object_unref (req->obj);
+  g_free (req);
+}
+
+/**
+ * @brief Hand the method invocation to the worker pool, serialized per resource name.
+ * @return @c TRUE if the request is handled. FALSE if the service is not available.
+ */
+static gboolean
+_resource_dispatch (MachinelearningServiceResource *obj,
+    GDBusMethodInvocation *invoc, const gchar *name)
+{
+  resource_dispatch_request_s *req;
+  g_autofree gchar *key = g_strdup_printf ("resource:%s", name ? name : "*");
+
+  req = g_new0 (resource_dispatch_request_s, 1);
+  req->obj = (MachinelearningServiceResource *) g_object_ref (obj);
+  req->invoc = invoc;
+
+  if (gdbus_dispatch_push (key, _resource_dispatch_worker, req) != 0) {
+    /* The dispatch layer is not available, handle it synchronously. */
+    _resource_dispatch_worker (req);
+  }
+
+  return TRUE;
+}
+
 /**
  * @brief The callback function of Add method
  * @param obj Proxy instance.
@@ -54,12 +140,22 @@ static gboolean
 gdbus_cb_resource_add (MachinelearningServiceResource *obj, GDBusMethodInvocation *invoc,
     const gchar *name, const gchar *path, const gchar *description, const gchar *app_info)
 {
-  gint ret = 0;
-
-  ret = svcdb_resource_add (name, path, description, app_info);
-  machinelearning_service_resource_complete_add (obj, invoc, ret);
+  return _resource_dispatch (obj, invoc, name);
+}
 
-  return TRUE;
+/**
+ * @brief The callback function of AddMany method
+ * @param obj Proxy instance.
+ * @param invoc Method invocation handle.
+ * @param resources The array of resources, (name, path, description, app_info).
+ * @return @c TRUE if the request is handled. FALSE if the service is not available.
+ */
+static gboolean
+gdbus_cb_resource_add_many (MachinelearningServiceResource *obj,
+    GDBusMethodInvocation *invoc, GVariant *resources)
+{
+  /* A batch may span several resource names, serialize it with the whole interface. */
+  return _resource_dispatch (obj, invoc, NULL);
 }
 
 /**
@@ -73,13 +169,7 @@ static gboolean
 gdbus_cb_resource_get (MachinelearningServiceResource *obj,
     GDBusMethodInvocation *invoc, const gchar *name)
 {
-  gint ret = 0;
-  g_autofree gchar *res_info = NULL;
-
-  ret = svcdb_resource_get (name, &res_info);
-  machinelearning_service_resource_complete_get (obj, invoc, res_info, ret);
-
-  return TRUE;
+  return _resource_dispatch (obj, invoc, name);
 }
 
 /**
@@ -93,12 +183,7 @@ static gboolean
 gdbus_cb_resource_delete (MachinelearningServiceResource *obj,
     GDBusMethodInvocation *invoc, const gchar *name)
 {
-  gint ret = 0;
-
-  ret = svcdb_resource_delete (name);
-  machinelearning_service_resource_complete_delete (obj, invoc, ret);
-
-  return TRUE;
+  return _resource_dispatch (obj, invoc, name);
 }
 
 /**
@@ -111,6 +196,12 @@ static struct gdbus_signal_info res_handler_infos[] = {
       .cb_data = NULL,
       .handler_id = 0,
   },
+  {
+      .signal_name = DBUS_RESOURCE_I_HANDLER_ADD_MANY,
+      .cb = G_CALLBACK (gdbus_cb_resource_add_many),
+      .cb_data = NULL,
+      .handler_id = 0,
+  },
   {
       .signal_name = DBUS_RESOURCE_I_HANDLER_GET,
       .cb = G_CALLBACK (gdbus_cb_resource_get),
@@ -17,19 +17,35 @@
 
 G_BEGIN_DECLS
 
+/**
+ * @brief Storage mode of the ML service DB.
+ */
+typedef enum {
+  SVCDB_STORAGE_DEFAULT = 0, /**< Rollback journal with synchronous=FULL (SQLite default). */
+  SVCDB_STORAGE_WAL = 1, /**< WAL journal with synchronous=NORMAL, checkpoints batched in the background. */
+  SVCDB_STORAGE_WAL_RELAXED = 2, /**< WAL journal with synchronous=OFF for bulk registration. Durability is relaxed, commits may be lost on power failure. */
+} svcdb_storage_mode_e;
+
 void svcdb_initialize (const gchar *path);
+gint svcdb_initialize_checked (const gchar *path);
+void svcdb_set_storage_mode (svcdb_storage_mode_e mode);
+void svcdb_set_config_file (const gchar *path);
 void svcdb_finalize (void);
+gint svcdb_config_get (gchar **config);
 gint svcdb_pipeline_set (const gchar *name, const gchar *description);
 gint svcdb_pipeline_get (const gchar *name, gchar **description);
 gint svcdb_pipeline_delete (const gchar *name);
 gint svcdb_model_add (const gchar *name, const gchar *path, const bool is_active, const gchar *description, const gchar *app_info, guint *version);
+gint svcdb_model_add_many (GVariant *models, GVariant **versions);
 gint svcdb_model_update_description (const gchar *name, const guint version, const gchar *description);
 gint svcdb_model_activate (const gchar *name, const guint version);
 gint svcdb_model_get (const gchar *name, const guint version, gchar **model_info);
 gint svcdb_model_get_activated (const gchar *name, gchar **model_info);
 gint svcdb_model_get_all (const gchar *name, gchar **model_info);
+gint svcdb_model_list (const gchar *filter, const gint active_state, const guint offset, const guint limit, gchar **model_list);
 gint svcdb_model_delete (const gchar *name, const guint version);
 gint svcdb_resource_add (const gchar *name, const gchar *path, const gchar *description, const gchar *app_info);
+gint svcdb_resource_add_many (GVariant *resources);
 gint svcdb_resource_get (const gchar *name, gchar **res_info);
 gint svcdb_resource_delete (const gchar *name);
 
@@ -10,9 +10,13 @@
  * @bug     No known bugs except for NYI items
  */
 
+#include <glib/gstdio.h>
+
 #include "service-db.hh"
 #include "service-db-util.h"
+#include "service-snapshot.h"
 #include "log.h"
+#include "metrics-util.h"
 
 #define sqlite3_clear_errmsg(m) \
   do {                          \
@@ -30,7 +34,7 @@
 /**
  * @brief The version of model table schema. It should be a positive integer.
  */
-#define TBL_VER_MODEL_INFO (1)
+#define TBL_VER_MODEL_INFO (2)
 
 /**
  * @brief The version of resource table schema. It should be a positive integer.
@@ -54,14 +58,57 @@ const char *g_mlsvc_table_schema_v1[] = {
   /* Sentinel */ NULL
 };
 
-const char **g_mlsvc_table_schema = g_mlsvc_table_schema_v1;
+/**
+ * @brief The v2 schema adds the content fingerprint column to the model table.
+ */
+const char *g_mlsvc_table_schema_v2[] = {
+  /* TBL_DB_INFO */ "tblMLDBInfo (name TEXT PRIMARY KEY NOT NULL, version INTEGER DEFAULT 1)",
+  /* TBL_PIPELINE_DESCRIPTION */ "tblPipeline (key TEXT PRIMARY KEY NOT NULL, description TEXT, CHECK (length(description) > 0))",
+  /* TBL_MODEL_INFO */ "tblModel (key TEXT NOT NULL, version INTEGER DEFAULT 1, active TEXT DEFAULT 'F', path TEXT, description TEXT, app_info TEXT, fingerprint TEXT, PRIMARY KEY (key, version), CHECK (length(path) > 0), CHECK (active IN ('T', 'F')))",
+  /* TBL_RESOURCE_INFO */ "tblResource (key TEXT NOT NULL, path TEXT, description TEXT, app_info TEXT, PRIMARY KEY (key, path), CHECK (length(path) > 0))",
+  /* Sentinel */ NULL
+};
+
+/**
+ * @brief The indexes matching the hot queries of the v2 schema.
+ * The partial index serves the active-model lookup, the version index serves
+ * the next-version subquery of set_model, and the fingerprint index serves the
+ * unchanged-model check of set_model_if_changed.
+ */
+const char *g_mlsvc_index_schema_v2[] = {
+  "idx_model_active ON tblModel (key) WHERE active = 'T'",
+  "idx_model_version ON tblModel (key, version DESC)",
+  "idx_model_fingerprint ON tblModel (key, fingerprint)",
+  /* Sentinel */ NULL
+};
+
+const char **g_mlsvc_table_schema = g_mlsvc_table_schema_v2;
+const char **g_mlsvc_index_schema = g_mlsvc_index_schema_v2;
+
+/**
+ * @brief The interval of the background maintenance timer in seconds.
+ */
+#define SVCDB_MAINTENANCE_INTERVAL (30U)
+
+/**
+ * @brief The default quiet period before idle maintenance runs, in seconds.
+ */
+#define SVCDB_MAINTENANCE_IDLE_DEFAULT (10U)
+
+/**
+ * @brief The page budget of one incremental vacuum slice.
+ */
+#define SVCDB_VACUUM_PAGE_BUDGET "128"
 
 /**
  * @brief Construct a new MLServiceDB object.
  * @param path database path
+ * @param storage_mode storage mode of the database
+ * @param config_path path to the storage configuration file, or an empty string for the SQLite defaults
  */
-MLServiceDB::MLServiceDB (std::string path)
-    : _path (path), _initialized (false), _db (nullptr)
+MLServiceDB::MLServiceDB (std::string path, svcdb_storage_mode_e storage_mode, std::string config_path)
+    : _path (path), _config_path (config_path), _initialized (false),
+      _storage_mode (storage_mode), _tx_depth (0), _db (nullptr)
 {
 }
 
@@ -86,11 +133,8 @@ MLServiceDB::initDB ()
     return;
 
   /**
-   * @todo data migration
-   * handle database version and update each table
-   * 1. get all records from table
-   * 2. drop old table
-   * 3. create new table and insert records
+   * The table creation, migration, and version bookkeeping below run inside
+   * one transaction, so a failed migration leaves the previous schema intact.
    */
   if (!set_transaction (true))
     return;
@@ -117,12 +161,19 @@ MLServiceDB::initDB ()
     return;
 
   if (tbl_ver != TBL_VER_MODEL_INFO) {
-    /** @todo update model table if table schema is changed */
+    if (!migrate_model_table (tbl_ver))
+      return;
   }
 
   if (!set_table_version ("tblModel", TBL_VER_MODEL_INFO))
     return;
 
+  /* Create the indexes matching the hot queries. */
+  for (i = 0; g_mlsvc_index_schema[i] != NULL; i++) {
+    if (!create_index (g_mlsvc_index_schema[i]))
+      return;
+  }
+
   /* Check resource table. */
   if ((tbl_ver = get_table_version ("tblResource", TBL_VER_RESOURCE_INFO)) < 0)
     return;
@@ -140,6 +191,17 @@ MLServiceDB::initDB ()
   _initialized = true;
 }
 
+/**
+ * @brief Callback function invoked when the database file is busy.
+ * @note It returns 0 to keep the immediate SQLITE_BUSY failure, only counting the event.
+ */
+static int
+busy_metrics_cb (void *data, int count)
+{
+  ml_metrics_record ("sqlite.busy", 0);
+  return 0;
+}
+
 /**
  * @brief Connect to ML Service DB and initialize the private variables.
  */
@@ -159,6 +221,58 @@ MLServiceDB::connectDB ()
     goto error;
   }
 
+  sqlite3_busy_handler (_db, busy_metrics_cb, nullptr);
+
+  {
+    char *errmsg = nullptr;
+
+    /**
+     * Freed pages are kept on a list instead of shrinking the file, so the
+     * idle maintenance can reclaim them page by page (see maintain()). On a
+     * newly created DB this takes effect immediately; an existing DB keeps
+     * its old setting until a full VACUUM rebuilds it.
+     */
+    rc = sqlite3_exec (_db, "PRAGMA auto_vacuum=INCREMENTAL;", nullptr, nullptr, &errmsg);
+    if (rc != SQLITE_OK) {
+      ml_logw ("Failed to enable incremental vacuum: %s (%d)", errmsg, rc);
+      sqlite3_clear_errmsg (errmsg);
+    }
+  }
+
+  /**
+   * In WAL mode, writers do not block readers and a commit only appends to
+   * the log, so checkpoints can be batched in the background (see checkpoint()).
+   * The relaxed mode additionally skips fsync on commit, grouping the commits
+   * of a bulk registration into a single flush at checkpoint time.
+   */
+  if (_storage_mode == SVCDB_STORAGE_WAL || _storage_mode == SVCDB_STORAGE_WAL_RELAXED) {
+    char *errmsg = nullptr;
+
+    rc = sqlite3_exec (_db, "PRAGMA journal_mode=WAL;", nullptr, nullptr, &errmsg);
+    if (rc != SQLITE_OK) {
+      ml_logw ("Failed to enable WAL journal mode: %s (%d)", errmsg, rc);
+      sqlite3_clear_errmsg (errmsg);
+    } else {
+      const char *sync_pragma = (_storage_mode == SVCDB_STORAGE_WAL_RELAXED) ?
+          "PRAGMA synchronous=OFF;" : "PRAGMA synchronous=NORMAL;";
+
+      rc = sqlite3_exec (_db, sync_pragma, nullptr, nullptr, &errmsg);
+      if (rc != SQLITE_OK) {
+        ml_logw ("Failed to set synchronous mode: %s (%d)", errmsg, rc);
+        sqlite3_clear_errmsg (errmsg);
+      }
+
+      /* Checkpoints are driven by the background timer, not by each commit. */
+      rc = sqlite3_exec (_db, "PRAGMA wal_autocheckpoint=0;", nullptr, nullptr, &errmsg);
+      if (rc != SQLITE_OK) {
+        ml_logw ("Failed to disable auto-checkpoint: %s (%d)", errmsg, rc);
+        sqlite3_clear_errmsg (errmsg);
+      }
+    }
+  }
+
+  apply_config ();
+
   initDB ();
 
 error:
@@ -175,30 +289,270 @@ void
 MLServiceDB::disconnectDB ()
 {
   if (_db) {
+    checkpoint ();
+    clear_stmt_cache ();
+    _active_model_cache.clear ();
+    _pipeline_cache.clear ();
     sqlite3_close (_db);
     _db = nullptr;
   }
 }
 
+/**
+ * @brief Transfer the accumulated WAL content into the database file.
+ * @note This is a no-op unless the DB is opened in a WAL storage mode.
+ */
+void
+MLServiceDB::checkpoint ()
+{
+  int rc;
+
+  if (!_db || _storage_mode == SVCDB_STORAGE_DEFAULT)
+    return;
+
+  rc = sqlite3_wal_checkpoint_v2 (_db, nullptr, SQLITE_CHECKPOINT_PASSIVE, nullptr, nullptr);
+  if (rc != SQLITE_OK)
+    ml_logw ("Failed to checkpoint the WAL: %s (%d)", sqlite3_errmsg (_db), rc);
+}
+
+/**
+ * @brief Run one bounded slice of background DB maintenance.
+ * @note This reclaims a fixed page budget of freed space and refreshes the
+ * query-planner statistics. PRAGMA optimize only re-analyzes tables whose
+ * content changed enough to matter, so both steps stay within a few
+ * milliseconds and a foreground call arriving meanwhile is not blocked
+ * for long. The caller holds the svcdb lock.
+ */
+void
+MLServiceDB::maintain ()
+{
+  char *errmsg = nullptr;
+  gint64 start;
+  int rc;
+
+  if (!_db)
+    return;
+
+  start = g_get_monotonic_time ();
+
+  rc = sqlite3_exec (_db, "PRAGMA incremental_vacuum(" SVCDB_VACUUM_PAGE_BUDGET ");",
+      nullptr, nullptr, &errmsg);
+  if (rc != SQLITE_OK) {
+    ml_logw ("Failed to run the incremental vacuum: %s (%d)", errmsg, rc);
+    sqlite3_clear_errmsg (errmsg);
+  }
+
+  rc = sqlite3_exec (_db, "PRAGMA optimize;", nullptr, nullptr, &errmsg);
+  if (rc != SQLITE_OK) {
+    ml_logw ("Failed to refresh the statistics: %s (%d)", errmsg, rc);
+    sqlite3_clear_errmsg (errmsg);
+  }
+
+  ml_metrics_record ("sqlite.maintain", g_get_monotonic_time () - start);
+}
+
+/**
+ * @brief Serialize the pipeline descriptions and the activated models into the read snapshot.
+ * @note The snapshot serves svcdb_pipeline_get() and svcdb_model_get_activated()
+ * without touching SQLite (see the wrappers below). The caller holds the svcdb lock.
+ */
+void
+MLServiceDB::write_snapshot ()
+{
+  GHashTable *entries;
+  sqlite3_stmt *res;
+
+  if (!_db)
+    return;
+
+  entries = g_hash_table_new_full (g_str_hash, g_str_equal, g_free, g_free);
+
+  res = get_stmt ("SELECT key, description FROM tblPipeline");
+  while (res && sqlite3_step (res) == SQLITE_ROW) {
+    g_hash_table_insert (entries,
+        g_strdup ((const gchar *) sqlite3_column_text (res, 0)),
+        g_strdup ((const gchar *) sqlite3_column_text (res, 1)));
+  }
+  sqlite3_reset (res);
+
+  res = get_stmt (
+      "SELECT key, json_object('version', CAST(version AS TEXT), 'active', active, "
+      "'path', path, 'description', description, 'app_info', app_info) "
+      "FROM tblModel WHERE active = 'T'");
+  while (res && sqlite3_step (res) == SQLITE_ROW) {
+    g_hash_table_insert (entries,
+        g_strdup ((const gchar *) sqlite3_column_text (res, 0)),
+        g_strdup ((const gchar *) sqlite3_column_text (res, 1)));
+  }
+  sqlite3_reset (res);
+
+  if (svcdb_snapshot_store (_path.c_str (), entries) != 0)
+    ml_logw ("Failed to store the read snapshot of the DB.");
+
+  g_hash_table_destroy (entries);
+}
+
+/**
+ * @brief Apply the storage configuration pragmas loaded from the config file.
+ * @note The config file is a key file with a [sqlite] group holding mmap_size,
+ * cache_size, temp_store, and page_size keys. Missing keys keep the SQLite
+ * defaults, so one binary can be tuned per deployment tier without a rebuild.
+ * page_size only takes effect on a newly created database file. The effective
+ * values are read back, logged, and kept for get_config(), as SQLite silently
+ * clamps out-of-range requests.
+ */
+void
+MLServiceDB::apply_config ()
+{
+  /* page_size is applied first, it must precede any page allocation. */
+  static const char *config_keys[]
+      = { "page_size", "mmap_size", "cache_size", "temp_store" };
+  static const char *report_keys[]
+      = { "journal_mode", "page_size", "mmap_size", "cache_size", "temp_store" };
+  std::string desc;
+  guint i;
+
+  if (!_config_path.empty ()) {
+    g_autoptr (GKeyFile) key_file = g_key_file_new ();
+    g_autoptr (GError) err = nullptr;
+
+    if (!g_key_file_load_from_file (key_file, _config_path.c_str (), G_KEY_FILE_NONE, &err)) {
+      ml_logw ("Failed to load the DB config file %s: %s", _config_path.c_str (),
+          err ? err->message : "unknown error");
+    } else {
+      for (i = 0; i < G_N_ELEMENTS (config_keys); i++) {
+        g_autofree gchar *value
+            = g_key_file_get_value (key_file, "sqlite", config_keys[i], nullptr);
+        char *errmsg = nullptr;
+        int rc;
+
+        if (!value)
+          continue;
+
+        g_autofree gchar *sql
+            = g_strdup_printf ("PRAGMA %s=%s;", config_keys[i], g_strstrip (value));
+        rc = sqlite3_exec (_db, sql, nullptr, nullptr, &errmsg);
+        if (rc != SQLITE_OK) {
+          ml_logw ("Failed to apply '%s': %s (%d)", sql, errmsg, rc);
+          sqlite3_clear_errmsg (errmsg);
+        }
+      }
+    }
+  }
+
+  for (i = 0; i < G_N_ELEMENTS (report_keys); i++) {
+    g_autofree gchar *sql = g_strdup_printf ("PRAGMA %s;", report_keys[i]);
+    sqlite3_stmt *res = nullptr;
+
+    if (sqlite3_prepare_v2 (_db, sql, -1, &res, nullptr) == SQLITE_OK
+        && sqlite3_step (res) == SQLITE_ROW) {
+      const char *value = (const char *) sqlite3_column_text (res, 0);
+
+      if (!desc.empty ())
+        desc += ",";
+      desc += std::string (report_keys[i]) + "=" + (value ? value : "");
+    }
+    if (res)
+      sqlite3_finalize (res);
+  }
+
+  _config_desc = desc;
+  ml_logi ("Storage configuration: %s", _config_desc.c_str ());
+}
+
+/**
+ * @brief Get the effective storage configuration of the opened DB.
+ * @param[out] config The effective journal mode and pragma values as a comma-separated key=value string.
+ */
+void
+MLServiceDB::get_config (gchar **config)
+{
+  if (!config)
+    throw std::invalid_argument ("Invalid config parameter!");
+
+  if (!_db || _config_desc.empty ())
+    throw std::runtime_error ("DB is not opened, no configuration applied.");
+
+  *config = g_strdup (_config_desc.c_str ());
+}
+
+/**
+ * @brief Get the precompiled statement of given SQL, compiling it on first use.
+ * @note The returned statement is owned by the statement cache and must not be finalized by the caller.
+ * Call sqlite3_reset() after use to release the database lock held by the statement.
+ */
+sqlite3_stmt *
+MLServiceDB::get_stmt (const std::string &sql)
+{
+  sqlite3_stmt *res;
+  auto iter = _stmt_cache.find (sql);
+
+  if (iter != _stmt_cache.end ()) {
+    res = iter->second;
+    sqlite3_reset (res);
+    sqlite3_clear_bindings (res);
+    return res;
+  }
+
+  gint64 start = g_get_monotonic_time ();
+
+  if (sqlite3_prepare_v2 (_db, sql.c_str (), -1, &res, nullptr) != SQLITE_OK) {
+    ml_logw ("Failed to prepare statement '%s': %s", sql.c_str (), sqlite3_errmsg (_db));
+    return nullptr;
+  }
+
+  ml_metrics_record ("sqlite.prepare", g_get_monotonic_time () - start);
+  _stmt_cache[sql] = res;
+  return res;
+}
+
+/**
+ * @brief Compose the prefixed DB key of the given name into the reusable buffer.
+ * @note The prefix and the kind are concatenated at compile time at the call
+ * sites. Reusing the instance buffer avoids the per-call heap allocations of
+ * key composition, which add up to heap fragmentation at our call rates.
+ * The reference is valid until the next build_key() call; all callers run
+ * under the svcdb lock, so the buffer is never shared.
+ */
+const std::string &
+MLServiceDB::build_key (const char *prefix, const std::string &name)
+{
+  _key_buf.assign (prefix);
+  _key_buf.append (name);
+  return _key_buf;
+}
+
+/**
+ * @brief Finalize all precompiled statements. It should be called before closing the DB.
+ */
+void
+MLServiceDB::clear_stmt_cache ()
+{
+  for (auto &iter : _stmt_cache)
+    sqlite3_finalize (iter.second);
+
+  _stmt_cache.clear ();
+}
+
 /**
  * @brief Get table version.
  */
 int
-MLServiceDB::get_table_version (const std::string tbl_name, const int default_ver)
+MLServiceDB::get_table_version (const std::string &tbl_name, const int default_ver)
 {
-  int rc, tbl_ver;
+  int tbl_ver;
   sqlite3_stmt *res;
-  std::string sql = "SELECT version FROM tblMLDBInfo WHERE name = '" + tbl_name + "';";
 
-  rc = sqlite3_prepare_v2 (_db, sql.c_str (), -1, &res, nullptr);
-  if (rc != SQLITE_OK) {
-    ml_logw ("Failed to get the version of table %s: %s (%d)",
-        tbl_name.c_str (), sqlite3_errmsg (_db), rc);
+  res = get_stmt ("SELECT version FROM tblMLDBInfo WHERE name = ?1;");
+  if (!res || sqlite3_bind_text (res, 1, tbl_name.c_str (), -1, nullptr) != SQLITE_OK) {
+    ml_logw ("Failed to get the version of table %s: %s",
+        tbl_name.c_str (), sqlite3_errmsg (_db));
+    sqlite3_reset (res);
     return -1;
   }
 
   tbl_ver = (sqlite3_step (res) == SQLITE_ROW) ? sqlite3_column_int (res, 0) : default_ver;
-  sqlite3_finalize (res);
+  sqlite3_reset (res);
 
   return tbl_ver;
 }
@@ -207,17 +561,16 @@ MLServiceDB::get_table_version (const std::string tbl_name, const int default_ve
  * @brief Set table version.
  */
 bool
-MLServiceDB::set_table_version (const std::string tbl_name, const int tbl_ver)
+MLServiceDB::set_table_version (const std::string &tbl_name, const int tbl_ver)
 {
-  sqlite3_stmt *res;
-  std::string sql = "INSERT OR REPLACE INTO tblMLDBInfo VALUES (?1, ?2);";
+  sqlite3_stmt *res = get_stmt ("INSERT OR REPLACE INTO tblMLDBInfo VALUES (?1, ?2);");
 
-  bool is_done = (sqlite3_prepare_v2 (_db, sql.c_str (), -1, &res, nullptr) == SQLITE_OK
+  bool is_done = (res != nullptr
                   && sqlite3_bind_text (res, 1, tbl_name.c_str (), -1, nullptr) == SQLITE_OK
                   && sqlite3_bind_int (res, 2, tbl_ver) == SQLITE_OK
                   && sqlite3_step (res) == SQLITE_DONE);
 
-  sqlite3_finalize (res);
+  sqlite3_reset (res);
 
   if (!is_done)
     ml_logw ("Failed to update version of table %s.", tbl_name.c_str ());
@@ -228,7 +581,7 @@ MLServiceDB::set_table_version (const std::string tbl_name, const int tbl_ver)
  * @brief Create DB table.
  */
 bool
-MLServiceDB::create_table (const std::string tbl_name)
+MLServiceDB::create_table (const std::string &tbl_name)
 {
   int rc;
   char *errmsg = nullptr;
@@ -244,8 +597,101 @@ MLServiceDB::create_table (const std::string tbl_name)
   return true;
 }
 
+/**
+ * @brief Create DB index.
+ */
+bool
+MLServiceDB::create_index (const std::string &idx_name)
+{
+  int rc;
+  char *errmsg = nullptr;
+  std::string sql = "CREATE INDEX IF NOT EXISTS " + idx_name;
+
+  rc = sqlite3_exec (_db, sql.c_str (), nullptr, nullptr, &errmsg);
+  if (rc != SQLITE_OK) {
+    ml_logw ("Failed to create index %s: %s (%d)", idx_name.c_str (), errmsg, rc);
+    sqlite3_clear_errmsg (errmsg);
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * @brief Migrate the model table to the current schema version.
+ * @details The old table is renamed aside, the current table is created from
+ * the schema, and the rows are bulk re-inserted, all inside the enclosing
+ * transaction of initDB() so a failure leaves the old data intact. A v1 table
+ * that already got the fingerprint column appended in place is handled, too.
+ * @param[in] from_ver The schema version recorded for the stored table.
+ * @return @c true if the table matches the current schema when returning.
+ */
+bool
+MLServiceDB::migrate_model_table (const int from_ver)
+{
+  int rc;
+  char *errmsg = nullptr;
+  const char *insert_sql;
+  sqlite3_stmt *probe = nullptr;
+  std::string create_sql;
+
+  if (from_ver >= TBL_VER_MODEL_INFO)
+    return true;
+
+  if (from_ver != 1) {
+    ml_loge ("Cannot migrate the model table from unknown version %d.", from_ver);
+    return false;
+  }
+
+  ml_logi ("Migrating the model table from version %d to %d.", from_ver, TBL_VER_MODEL_INFO);
+
+  rc = sqlite3_exec (_db, "ALTER TABLE tblModel RENAME TO tblModelMigrate;",
+      nullptr, nullptr, &errmsg);
+  if (rc != SQLITE_OK) {
+    ml_loge ("Failed to rename the old model table: %s (%d)", errmsg, rc);
+    sqlite3_clear_errmsg (errmsg);
+    return false;
+  }
+
+  create_sql = "CREATE TABLE " + std::string (g_mlsvc_table_schema[TBL_MODEL_INFO]);
+  rc = sqlite3_exec (_db, create_sql.c_str (), nullptr, nullptr, &errmsg);
+  if (rc != SQLITE_OK) {
+    ml_loge ("Failed to create the model table: %s (%d)", errmsg, rc);
+    sqlite3_clear_errmsg (errmsg);
+    return false;
+  }
+
+  /* Probe whether the old table already has the fingerprint column. */
+  if (sqlite3_prepare_v2 (_db, "SELECT fingerprint FROM tblModelMigrate LIMIT 1;",
+          -1, &probe, nullptr) == SQLITE_OK) {
+    sqlite3_finalize (probe);
+    insert_sql = "INSERT INTO tblModel SELECT key, version, active, path, description, app_info, fingerprint FROM tblModelMigrate;";
+  } else {
+    insert_sql = "INSERT INTO tblModel (key, version, active, path, description, app_info) SELECT key, version, active, path, description, app_info FROM tblModelMigrate;";
+  }
+
+  rc = sqlite3_exec (_db, insert_sql, nullptr, nullptr, &errmsg);
+  if (rc != SQLITE_OK) {
+    ml_loge ("Failed to re-insert the model rows: %s (%d)", errmsg, rc);
+    sqlite3_clear_errmsg (errmsg);
+    return false;
+  }
+
+  rc = sqlite3_exec (_db, "DROP TABLE tblModelMigrate;", nullptr, nullptr, &errmsg);
+  if (rc != SQLITE_OK) {
+    ml_loge ("Failed to drop the old model table: %s (%d)", errmsg, rc);
+    sqlite3_clear_errmsg (errmsg);
+    return false;
+  }
+
+  return true;
+}
+
 /**
  * @brief Begin/end transaction.
+ * @note Transactions may be nested. SQLite only supports one open transaction
+ * per connection, so the statement is executed at the outermost level only and
+ * the inner levels merely update the nesting depth.
  */
 bool
 MLServiceDB::set_transaction (bool begin)
@@ -253,15 +699,74 @@ MLServiceDB::set_transaction (bool begin)
   int rc;
   char *errmsg = nullptr;
 
+  if (begin) {
+    if (_tx_depth++ > 0)
+      return true;
+  } else {
+    if (_tx_depth <= 0) {
+      ml_logw ("Failed to end transaction, no transaction is open.");
+      return false;
+    }
+    if (--_tx_depth > 0)
+      return true;
+  }
+
   rc = sqlite3_exec (_db, begin ? "BEGIN TRANSACTION;" : "END TRANSACTION;",
       nullptr, nullptr, &errmsg);
-  if (rc != SQLITE_OK)
+  if (rc != SQLITE_OK) {
     ml_logw ("Failed to %s transaction: %s (%d)", begin ? "begin" : "end", errmsg, rc);
+    if (begin)
+      _tx_depth = 0;
+  }
 
   sqlite3_clear_errmsg (errmsg);
   return (rc == SQLITE_OK);
 }
 
+/**
+ * @brief Open a transaction scope to group the following operations.
+ */
+void
+MLServiceDB::begin_transaction ()
+{
+  if (!set_transaction (true))
+    throw std::runtime_error ("Failed to begin transaction.");
+}
+
+/**
+ * @brief Close the transaction scope and commit the grouped operations.
+ */
+void
+MLServiceDB::end_transaction ()
+{
+  if (!set_transaction (false))
+    throw std::runtime_error ("Failed to end transaction.");
+}
+
+/**
+ * @brief Discard the open transaction and all operations grouped in it.
+ */
+void
+MLServiceDB::rollback_transaction ()
+{
+  int rc;
+  char *errmsg = nullptr;
+
+  if (_tx_depth <= 0)
+    return;
+
+  _tx_depth = 0;
+
+  rc = sqlite3_exec (_db, "ROLLBACK TRANSACTION;", nullptr, nullptr, &errmsg);
+  if (rc != SQLITE_OK)
+    ml_logw ("Failed to rollback transaction: %s (%d)", errmsg, rc);
+
+  sqlite3_clear_errmsg (errmsg);
+
+  /* The cache may hold descriptions written inside the discarded scope. */
+  _pipeline_cache.clear ();
+}
+
 /**
  * @brief Set the pipeline description with the given name.
  * @note If the name already exists, the pipeline description is overwritten.
@@ -269,33 +774,38 @@ MLServiceDB::set_transaction (bool begin)
  * @param[in] description The pipeline description to be stored.
  */
 void
-MLServiceDB::set_pipeline (const std::string name, const std::string description)
+MLServiceDB::set_pipeline (const std::string &name, const std::string &description)
 {
   sqlite3_stmt *res;
 
   if (name.empty () || description.empty ())
     throw std::invalid_argument ("Invalid name or value parameters!");
 
-  std::string key_with_prefix = DB_KEY_PREFIX + std::string ("_pipeline_");
-  key_with_prefix += name;
+  const std::string &key_with_prefix = build_key (DB_KEY_PREFIX "_pipeline_", name);
 
   if (!set_transaction (true))
     throw std::runtime_error ("Failed to begin transaction.");
 
-  if (sqlite3_prepare_v2 (_db,
-          "INSERT OR REPLACE INTO tblPipeline VALUES (?1, ?2)", -1, &res, nullptr)
-          != SQLITE_OK
-      || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
+  res = get_stmt ("INSERT OR REPLACE INTO tblPipeline VALUES (?1, ?2)");
+  if (!res || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_bind_text (res, 2, description.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_step (res) != SQLITE_DONE) {
-    sqlite3_finalize (res);
+    sqlite3_reset (res);
     throw std::runtime_error ("Failed to insert pipeline description of " + name);
   }
 
-  sqlite3_finalize (res);
+  sqlite3_reset (res);
 
   if (!set_transaction (false))
     throw std::runtime_error ("Failed to end transaction.");
+
+  /**
+   * The daemon is the only writer, keep the cache in sync on write. Skip the
+   * write-through inside an enclosing transaction scope, where the row is not
+   * committed yet and may still be rolled back.
+   */
+  if (_tx_depth == 0)
+    _pipeline_cache[key_with_prefix] = description;
 }
 
 /**
@@ -304,7 +814,7 @@ MLServiceDB::set_pipeline (const std::string name, const std::string description
  * @param[out] description The pipeline corresponding with the given name.
  */
 void
-MLServiceDB::get_pipeline (const std::string name, gchar **description)
+MLServiceDB::get_pipeline (const std::string &name, gchar **description)
 {
   char *value = nullptr;
   sqlite3_stmt *res;
@@ -312,19 +822,26 @@ MLServiceDB::get_pipeline (const std::string name, gchar **description)
   if (name.empty () || !description)
     throw std::invalid_argument ("Invalid name or description parameter!");
 
-  std::string key_with_prefix = DB_KEY_PREFIX + std::string ("_pipeline_");
-  key_with_prefix += name;
+  const std::string &key_with_prefix = build_key (DB_KEY_PREFIX "_pipeline_", name);
+
+  /* serve repeat launches from the cache, skipping the database query */
+  auto iter = _pipeline_cache.find (key_with_prefix);
+  if (iter != _pipeline_cache.end ()) {
+    *description = g_strdup (iter->second.c_str ());
+    return;
+  }
 
-  if (sqlite3_prepare_v2 (_db,
-          "SELECT description FROM tblPipeline WHERE key = ?1", -1, &res, nullptr)
-          == SQLITE_OK
-      && sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) == SQLITE_OK
+  res = get_stmt ("SELECT description FROM tblPipeline WHERE key = ?1");
+  if (res && sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) == SQLITE_OK
       && sqlite3_step (res) == SQLITE_ROW)
-    value = g_strdup_printf ("%s", sqlite3_column_text (res, 0));
+    value = g_strdup ((const gchar *) sqlite3_column_text (res, 0));
 
-  sqlite3_finalize (res);
+  sqlite3_reset (res);
 
   if (value) {
+    /* Do not fill the cache from uncommitted rows of an open scope. */
+    if (_tx_depth == 0)
+      _pipeline_cache[key_with_prefix] = value;
     *description = value;
   } else {
     throw std::invalid_argument ("Failed to get pipeline description of " + name);
@@ -336,24 +853,25 @@ MLServiceDB::get_pipeline (const std::string name, gchar **description)
  * @param[in] name The unique name to delete.
  */
 void
-MLServiceDB::delete_pipeline (const std::string name)
+MLServiceDB::delete_pipeline (const std::string &name)
 {
   sqlite3_stmt *res;
 
   if (name.empty ())
     throw std::invalid_argument ("Invalid name parameters!");
 
-  std::string key_with_prefix = DB_KEY_PREFIX + std::string ("_pipeline_");
-  key_with_prefix += name;
+  const std::string &key_with_prefix = build_key (DB_KEY_PREFIX "_pipeline_", name);
 
-  if (sqlite3_prepare_v2 (_db, "DELETE FROM tblPipeline WHERE key = ?1", -1, &res, nullptr) != SQLITE_OK
-      || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
+  _pipeline_cache.erase (key_with_prefix);
+
+  res = get_stmt ("DELETE FROM tblPipeline WHERE key = ?1");
+  if (!res || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_step (res) != SQLITE_DONE) {
-    sqlite3_finalize (res);
+    sqlite3_reset (res);
     throw std::runtime_error ("Failed to delete pipeline description of " + name);
   }
 
-  sqlite3_finalize (res);
+  sqlite3_reset (res);
 
   if (sqlite3_changes (_db) == 0) {
     throw std::invalid_argument ("There is no pipeline description of " + name);
@@ -364,24 +882,22 @@ MLServiceDB::delete_pipeline (const std::string name)
  * @brief Check the model is registered.
  */
 bool
-MLServiceDB::is_model_registered (const std::string key, const guint version)
+MLServiceDB::is_model_registered (const std::string &key, const guint version)
 {
   sqlite3_stmt *res;
-  gchar *sql;
   bool registered;
 
-  if (version > 0U)
-    sql = g_strdup_printf (
-        "SELECT EXISTS(SELECT 1 FROM tblModel WHERE key = ?1 AND version = %u)", version);
-  else
-    sql = g_strdup ("SELECT EXISTS(SELECT 1 FROM tblModel WHERE key = ?1)");
+  if (version > 0U) {
+    res = get_stmt ("SELECT EXISTS(SELECT 1 FROM tblModel WHERE key = ?1 AND version = ?2)");
+    if (res && sqlite3_bind_int (res, 2, version) != SQLITE_OK)
+      res = nullptr;
+  } else {
+    res = get_stmt ("SELECT EXISTS(SELECT 1 FROM tblModel WHERE key = ?1)");
+  }
 
-  registered
-      = !(sqlite3_prepare_v2 (_db, sql, -1, &res, nullptr) != SQLITE_OK
-          || sqlite3_bind_text (res, 1, key.c_str (), -1, nullptr) != SQLITE_OK
-          || sqlite3_step (res) != SQLITE_ROW || sqlite3_column_int (res, 0) != 1);
-  sqlite3_finalize (res);
-  g_free (sql);
+  registered = !(!res || sqlite3_bind_text (res, 1, key.c_str (), -1, nullptr) != SQLITE_OK
+                 || sqlite3_step (res) != SQLITE_ROW || sqlite3_column_int (res, 0) != 1);
+  sqlite3_reset (res);
 
   return registered;
 }
@@ -390,21 +906,18 @@ MLServiceDB::is_model_registered (const std::string key, const guint version)
  * @brief Check the model is activated.
  */
 bool
-MLServiceDB::is_model_activated (const std::string key, const guint version)
+MLServiceDB::is_model_activated (const std::string &key, const guint version)
 {
   sqlite3_stmt *res;
-  gchar *sql;
   bool activated;
 
-  sql = g_strdup ("SELECT active FROM tblModel WHERE key = ?1 AND version = ?2");
+  res = get_stmt ("SELECT active FROM tblModel WHERE key = ?1 AND version = ?2");
 
-  activated = !(sqlite3_prepare_v2 (_db, sql, -1, &res, nullptr) != SQLITE_OK
-                || sqlite3_bind_text (res, 1, key.c_str (), -1, nullptr) != SQLITE_OK
+  activated = !(!res || sqlite3_bind_text (res, 1, key.c_str (), -1, nullptr) != SQLITE_OK
                 || sqlite3_bind_int (res, 2, version) != SQLITE_OK
                 || sqlite3_step (res) != SQLITE_ROW
                 || !g_str_equal (sqlite3_column_text (res, 0), "T"));
-  sqlite3_finalize (res);
-  g_free (sql);
+  sqlite3_reset (res);
 
   return activated;
 }
@@ -413,20 +926,16 @@ MLServiceDB::is_model_activated (const std::string key, const guint version)
  * @brief Check the resource is registered.
  */
 bool
-MLServiceDB::is_resource_registered (const std::string key)
+MLServiceDB::is_resource_registered (const std::string &key)
 {
   sqlite3_stmt *res;
-  gchar *sql;
   bool registered;
 
-  sql = g_strdup_printf ("SELECT EXISTS(SELECT 1 FROM tblResource WHERE key = ?1)");
+  res = get_stmt ("SELECT EXISTS(SELECT 1 FROM tblResource WHERE key = ?1)");
 
-  registered
-      = !(sqlite3_prepare_v2 (_db, sql, -1, &res, nullptr) != SQLITE_OK
-          || sqlite3_bind_text (res, 1, key.c_str (), -1, nullptr) != SQLITE_OK
-          || sqlite3_step (res) != SQLITE_ROW || sqlite3_column_int (res, 0) != 1);
-  sqlite3_finalize (res);
-  g_free (sql);
+  registered = !(!res || sqlite3_bind_text (res, 1, key.c_str (), -1, nullptr) != SQLITE_OK
+                 || sqlite3_step (res) != SQLITE_ROW || sqlite3_column_int (res, 0) != 1);
+  sqlite3_reset (res);
 
   return registered;
 }
@@ -441,8 +950,8 @@ MLServiceDB::is_resource_registered (const std::string key)
  * @param[out] version The version of the model.
  */
 void
-MLServiceDB::set_model (const std::string name, const std::string model, const bool is_active,
-    const std::string description, const std::string app_info, guint *version)
+MLServiceDB::set_model (const std::string &name, const std::string &model, const bool is_active,
+    const std::string &description, const std::string &app_info, guint *version)
 {
   guint _version = 0U;
   sqlite3_stmt *res;
@@ -450,41 +959,41 @@ MLServiceDB::set_model (const std::string name, const std::string model, const b
   if (name.empty () || model.empty () || !version)
     throw std::invalid_argument ("Invalid name, model, or version parameter!");
 
-  std::string key_with_prefix = DB_KEY_PREFIX + std::string ("_model_");
-  key_with_prefix += name;
+  const std::string &key_with_prefix = build_key (DB_KEY_PREFIX "_model_", name);
+
+  std::string fingerprint = get_model_fingerprint (model);
+
+  _active_model_cache.erase (key_with_prefix);
 
   if (!set_transaction (true))
     throw std::runtime_error ("Failed to begin transaction.");
 
   /* set other models as NOT active */
   if (is_active) {
-    if (sqlite3_prepare_v2 (_db,
-            "UPDATE tblModel SET active = 'F' WHERE key = ?1", -1, &res, nullptr)
-            != SQLITE_OK
-        || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
+    res = get_stmt ("UPDATE tblModel SET active = 'F' WHERE key = ?1");
+    if (!res || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
         || sqlite3_step (res) != SQLITE_DONE) {
-      sqlite3_finalize (res);
+      sqlite3_reset (res);
       throw std::runtime_error ("Failed to set other models as NOT active.");
     }
-    sqlite3_finalize (res);
+    sqlite3_reset (res);
   }
 
   /* insert new row */
-  if (sqlite3_prepare_v2 (_db, "INSERT OR REPLACE INTO tblModel VALUES (?1, IFNULL ((SELECT version from tblModel WHERE key = ?2 ORDER BY version DESC LIMIT 1) + 1, 1), ?3, ?4, ?5, ?6)",
-          -1, &res, nullptr)
-          != SQLITE_OK
-      || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
+  res = get_stmt ("INSERT OR REPLACE INTO tblModel VALUES (?1, IFNULL ((SELECT version from tblModel WHERE key = ?2 ORDER BY version DESC LIMIT 1) + 1, 1), ?3, ?4, ?5, ?6, ?7)");
+  if (!res || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_bind_text (res, 2, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_bind_text (res, 3, is_active ? "T" : "F", -1, nullptr) != SQLITE_OK
       || sqlite3_bind_text (res, 4, model.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_bind_text (res, 5, description.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_bind_text (res, 6, app_info.c_str (), -1, nullptr) != SQLITE_OK
+      || sqlite3_bind_text (res, 7, fingerprint.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_step (res) != SQLITE_DONE) {
-    sqlite3_finalize (res);
+    sqlite3_reset (res);
     throw std::runtime_error ("Failed to register the model " + name);
   }
 
-  sqlite3_finalize (res);
+  sqlite3_reset (res);
 
   long long int last_id = sqlite3_last_insert_rowid (_db);
   if (last_id == 0) {
@@ -493,14 +1002,12 @@ MLServiceDB::set_model (const std::string name, const std::string model, const b
   }
 
   /* get model's version */
-  if (sqlite3_prepare_v2 (_db, "SELECT version FROM tblModel WHERE rowid = ? ORDER BY version DESC LIMIT 1;",
-          -1, &res, nullptr)
-          == SQLITE_OK
-      && sqlite3_bind_int (res, 1, last_id) == SQLITE_OK && sqlite3_step (res) == SQLITE_ROW) {
+  res = get_stmt ("SELECT version FROM tblModel WHERE rowid = ? ORDER BY version DESC LIMIT 1;");
+  if (res && sqlite3_bind_int (res, 1, last_id) == SQLITE_OK && sqlite3_step (res) == SQLITE_ROW) {
     _version = sqlite3_column_int (res, 0);
   }
 
-  sqlite3_finalize (res);
+  sqlite3_reset (res);
 
   if (!set_transaction (false))
     throw std::runtime_error ("Failed to end transaction.");
@@ -514,6 +1021,77 @@ MLServiceDB::set_model (const std::string name, const std::string model, const b
   *version = _version;
 }
 
+/**
+ * @brief Get the content fingerprint of the given model file.
+ * @note The fingerprint is a digest of the file path, size, and mtime, cheap
+ * enough for every registration. An empty string is returned when the file
+ * cannot be examined, which matches no stored fingerprint.
+ */
+std::string
+MLServiceDB::get_model_fingerprint (const std::string &path)
+{
+  GStatBuf st;
+
+  if (g_stat (path.c_str (), &st) != 0)
+    return "";
+
+  g_autofree gchar *ident = g_strdup_printf ("%s|%" G_GINT64_FORMAT "|%" G_GINT64_FORMAT,
+      path.c_str (), (gint64) st.st_size, (gint64) st.st_mtime);
+  g_autofree gchar *digest = g_compute_checksum_for_string (G_CHECKSUM_SHA256, ident, -1);
+
+  return digest ? std::string (digest) : "";
+}
+
+/**
+ * @brief Set the model with the given name, skipping the write when its file is unchanged.
+ * @note If a version of @a name with the same content fingerprint is already
+ * registered, no row is written and that version is returned. The activation
+ * request is still honored for a skipped model.
+ * @param[in] name Unique name for model.
+ * @param[in] model The model to be stored.
+ * @param[in] is_active The model is active or not.
+ * @param[in] description The model description.
+ * @param[in] app_info The application information.
+ * @param[out] version The version of the model.
+ */
+void
+MLServiceDB::set_model_if_changed (const std::string &name, const std::string &model,
+    const bool is_active, const std::string &description,
+    const std::string &app_info, guint *version)
+{
+  sqlite3_stmt *res;
+
+  if (name.empty () || model.empty () || !version)
+    throw std::invalid_argument ("Invalid name, model, or version parameter!");
+
+  std::string fingerprint = get_model_fingerprint (model);
+
+  if (!fingerprint.empty ()) {
+    const std::string &key_with_prefix = build_key (DB_KEY_PREFIX "_model_", name);
+
+    res = get_stmt ("SELECT version, active FROM tblModel WHERE key = ?1 AND fingerprint = ?2 ORDER BY version DESC LIMIT 1");
+    if (res && sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) == SQLITE_OK
+        && sqlite3_bind_text (res, 2, fingerprint.c_str (), -1, nullptr) == SQLITE_OK
+        && sqlite3_step (res) == SQLITE_ROW) {
+      guint found = (guint) sqlite3_column_int (res, 0);
+      bool active = g_strcmp0 ((const char *) sqlite3_column_text (res, 1), "T") == 0;
+
+      sqlite3_reset (res);
+
+      ml_logi ("The file of model %s is unchanged, version %u is reused.",
+          name.c_str (), found);
+      if (is_active && !active)
+        activate_model (name, found);
+
+      *version = found;
+      return;
+    }
+    sqlite3_reset (res);
+  }
+
+  set_model (name, model, is_active, description, app_info, version);
+}
+
 /**
  * @brief Update the model description with the given name.
  * @param[in] name Unique name for model.
@@ -522,7 +1100,7 @@ MLServiceDB::set_model (const std::string name, const std::string model, const b
  */
 void
 MLServiceDB::update_model_description (
-    const std::string name, const guint version, const std::string description)
+    const std::string &name, const guint version, const std::string &description)
 {
   sqlite3_stmt *res;
 
@@ -532,30 +1110,29 @@ MLServiceDB::update_model_description (
   if (version == 0U)
     throw std::invalid_argument ("Invalid version number!");
 
-  std::string key_with_prefix = DB_KEY_PREFIX + std::string ("_model_");
-  key_with_prefix += name;
+  const std::string &key_with_prefix = build_key (DB_KEY_PREFIX "_model_", name);
 
-  /* check the existence of given model */
-  if (!is_model_registered (key_with_prefix, version)) {
-    throw std::invalid_argument ("Failed to check the existence of " + name
-                                 + " version " + std::to_string (version));
-  }
+  _active_model_cache.erase (key_with_prefix);
 
   if (!set_transaction (true))
     throw std::runtime_error ("Failed to begin transaction.");
 
-  /* update model description */
-  if (sqlite3_prepare_v2 (_db, "UPDATE tblModel SET description = ?1 WHERE key = ?2 AND version = ?3",
-          -1, &res, nullptr)
-          != SQLITE_OK
-      || sqlite3_bind_text (res, 1, description.c_str (), -1, nullptr) != SQLITE_OK
+  /* update model description, the UPDATE itself doubles as the existence check */
+  res = get_stmt ("UPDATE tblModel SET description = ?1 WHERE key = ?2 AND version = ?3");
+  if (!res || sqlite3_bind_text (res, 1, description.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_bind_text (res, 2, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_bind_int (res, 3, version) != SQLITE_OK || sqlite3_step (res) != SQLITE_DONE) {
-    sqlite3_finalize (res);
+    sqlite3_reset (res);
     throw std::runtime_error ("Failed to update model description.");
   }
 
-  sqlite3_finalize (res);
+  sqlite3_reset (res);
+
+  if (sqlite3_changes (_db) == 0) {
+    set_transaction (false);
+    throw std::invalid_argument ("Failed to check the existence of " + name
+                                 + " version " + std::to_string (version));
+  }
 
   if (!set_transaction (false))
     throw std::runtime_error ("Failed to end transaction.");
@@ -567,7 +1144,7 @@ MLServiceDB::update_model_description (
  * @param[in] version The version of the model.
  */
 void
-MLServiceDB::activate_model (const std::string name, const guint version)
+MLServiceDB::activate_model (const std::string &name, const guint version)
 {
   sqlite3_stmt *res;
 
@@ -577,40 +1154,42 @@ MLServiceDB::activate_model (const std::string name, const guint version)
   if (version == 0U)
     throw std::invalid_argument ("Invalid version number!");
 
-  std::string key_with_prefix = DB_KEY_PREFIX + std::string ("_model_");
-  key_with_prefix += name;
+  const std::string &key_with_prefix = build_key (DB_KEY_PREFIX "_model_", name);
 
-  /* check the existence */
-  if (!is_model_registered (key_with_prefix, version)) {
-    throw std::invalid_argument ("There is no model with name " + name
-                                 + " and version " + std::to_string (version));
-  }
+  _active_model_cache.erase (key_with_prefix);
 
   if (!set_transaction (true))
     throw std::runtime_error ("Failed to begin transaction.");
 
-  /* set other row active as F */
-  if (sqlite3_prepare_v2 (_db, "UPDATE tblModel SET active = 'F' WHERE key = ?1", -1, &res, nullptr) != SQLITE_OK
-      || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
-      || sqlite3_step (res) != SQLITE_DONE) {
-    sqlite3_finalize (res);
-    throw std::runtime_error ("Failed to deactivate other models of " + name);
-  }
-
-  sqlite3_finalize (res);
-
-  /* set the given row active as T */
-  if (sqlite3_prepare_v2 (_db, "UPDATE tblModel SET active = 'T' WHERE key = ?1 AND version = ?2",
-          -1, &res, nullptr)
-          != SQLITE_OK
-      || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
+  /**
+   * Set the given row active as T first; its change count doubles as the
+   * existence check, and nothing is modified when the version is unknown.
+   */
+  res = get_stmt ("UPDATE tblModel SET active = 'T' WHERE key = ?1 AND version = ?2");
+  if (!res || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_bind_int (res, 2, version) != SQLITE_OK || sqlite3_step (res) != SQLITE_DONE) {
-    sqlite3_finalize (res);
+    sqlite3_reset (res);
     throw std::runtime_error ("Failed to activate model with name " + name
                               + " and version " + std::to_string (version));
   }
 
-  sqlite3_finalize (res);
+  sqlite3_reset (res);
+
+  if (sqlite3_changes (_db) == 0) {
+    set_transaction (false);
+    throw std::invalid_argument ("There is no model with name " + name
+                                 + " and version " + std::to_string (version));
+  }
+
+  /* set other rows active as F, only the rows that actually change are written */
+  res = get_stmt ("UPDATE tblModel SET active = 'F' WHERE key = ?1 AND version != ?2 AND active = 'T'");
+  if (!res || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
+      || sqlite3_bind_int (res, 2, version) != SQLITE_OK || sqlite3_step (res) != SQLITE_DONE) {
+    sqlite3_reset (res);
+    throw std::runtime_error ("Failed to deactivate other models of " + name);
+  }
+
+  sqlite3_reset (res);
 
   if (!set_transaction (false))
     throw std::runtime_error ("Failed to end transaction.");
@@ -623,19 +1202,27 @@ MLServiceDB::activate_model (const std::string name, const guint version)
  * @param[out] model The model corresponding with the given name.
  */
 void
-MLServiceDB::get_model (const std::string name, const gint version, gchar **model)
+MLServiceDB::get_model (const std::string &name, const gint version, gchar **model)
 {
   const char model_info_json[]
       = "json_object('version', CAST(version AS TEXT), 'active', active, 'path', path, 'description', description, 'app_info', app_info)";
-  char *sql;
+  g_autofree gchar *sql = nullptr;
   char *value = nullptr;
   sqlite3_stmt *res;
 
   if (name.empty () || !model)
     throw std::invalid_argument ("Invalid name or model parameters!");
 
-  std::string key_with_prefix = DB_KEY_PREFIX + std::string ("_model_");
-  key_with_prefix += name;
+  const std::string &key_with_prefix = build_key (DB_KEY_PREFIX "_model_", name);
+
+  /* serve the activated model from the cache, skipping the existence pre-check */
+  if (version == -1) {
+    auto iter = _active_model_cache.find (key_with_prefix);
+    if (iter != _active_model_cache.end ()) {
+      *model = g_strdup (iter->second.c_str ());
+      return;
+    }
+  }
 
   /* check the existence of given model */
   guint ver = (version > 0) ? version : 0U;
@@ -650,20 +1237,25 @@ MLServiceDB::get_model (const std::string name, const gint version, gchar **mode
     sql = g_strdup_printf ("SELECT %s FROM tblModel WHERE key = ?1 and active = 'T' ORDER BY version DESC LIMIT 1",
         model_info_json);
   else if (version > 0)
-    sql = g_strdup_printf ("SELECT %s FROM tblModel WHERE key = ?1 and version = %d",
-        model_info_json, version);
+    sql = g_strdup_printf (
+        "SELECT %s FROM tblModel WHERE key = ?1 and version = ?2", model_info_json);
   else
     throw std::invalid_argument ("Invalid version parameter!");
 
-  if (sqlite3_prepare_v2 (_db, sql, -1, &res, nullptr) == SQLITE_OK
-      && sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) == SQLITE_OK
+  res = get_stmt (sql);
+  if (res && version > 0 && sqlite3_bind_int (res, 2, version) != SQLITE_OK)
+    res = nullptr;
+
+  if (res && sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) == SQLITE_OK
       && sqlite3_step (res) == SQLITE_ROW)
-    value = g_strdup_printf ("%s", sqlite3_column_text (res, 0));
+    value = g_strdup ((const gchar *) sqlite3_column_text (res, 0));
 
-  sqlite3_finalize (res);
-  g_free (sql);
+  sqlite3_reset (res);
 
   if (value) {
+    /* fill the write-through cache for the activated-model hot path */
+    if (version == -1)
+      _active_model_cache[key_with_prefix] = value;
     *model = value;
   } else {
     throw std::invalid_argument ("Failed to get model with name " + name
@@ -671,22 +1263,75 @@ MLServiceDB::get_model (const std::string name, const gint version, gchar **mode
   }
 }
 
+/**
+ * @brief List the registered models page by page.
+ * @param[in] filter The SQL LIKE pattern to match model names. An empty string matches all models.
+ * @param[in] active_state Filter on the active flag. 1 for active models only, 0 for inactive only, -1 for any.
+ * @param[in] offset The number of matching rows to skip.
+ * @param[in] limit The maximum number of rows in the page. It should be a positive integer.
+ * @param[out] model_list The JSON array with the page of models. An empty page is not an error.
+ */
+void
+MLServiceDB::list_models (const std::string &filter, const gint active_state,
+    const guint offset, const guint limit, gchar **model_list)
+{
+  const char *sql;
+  char *value = nullptr;
+  sqlite3_stmt *res;
+
+  if (!model_list || limit == 0U)
+    throw std::invalid_argument ("Invalid model_list or limit parameters!");
+
+  std::string prefix = DB_KEY_PREFIX + std::string ("_model_");
+  std::string pattern = prefix + (filter.empty () ? "%" : filter);
+
+#define MODEL_LIST_JSON \
+  "json_object('name', substr(key, ?4), 'version', CAST(version AS TEXT), " \
+  "'active', active, 'path', path, 'description', description, 'app_info', app_info)"
+
+  if (active_state == 1)
+    sql = "SELECT json_group_array(" MODEL_LIST_JSON ") FROM (SELECT * FROM tblModel "
+          "WHERE key LIKE ?1 AND active = 'T' ORDER BY key ASC, version ASC LIMIT ?2 OFFSET ?3)";
+  else if (active_state == 0)
+    sql = "SELECT json_group_array(" MODEL_LIST_JSON ") FROM (SELECT * FROM tblModel "
+          "WHERE key LIKE ?1 AND active = 'F' ORDER BY key ASC, version ASC LIMIT ?2 OFFSET ?3)";
+  else
+    sql = "SELECT json_group_array(" MODEL_LIST_JSON ") FROM (SELECT * FROM tblModel "
+          "WHERE key LIKE ?1 ORDER BY key ASC, version ASC LIMIT ?2 OFFSET ?3)";
+
+#undef MODEL_LIST_JSON
+
+  res = get_stmt (sql);
+  if (res && sqlite3_bind_text (res, 1, pattern.c_str (), -1, nullptr) == SQLITE_OK
+      && sqlite3_bind_int (res, 2, limit) == SQLITE_OK
+      && sqlite3_bind_int (res, 3, offset) == SQLITE_OK
+      && sqlite3_bind_int (res, 4, prefix.size () + 1) == SQLITE_OK
+      && sqlite3_step (res) == SQLITE_ROW)
+    value = g_strdup ((const gchar *) sqlite3_column_text (res, 0));
+
+  sqlite3_reset (res);
+
+  if (value) {
+    *model_list = value;
+  } else {
+    throw std::runtime_error ("Failed to list models with filter " + filter);
+  }
+}
+
 /**
  * @brief Delete the model.
  * @param[in] name The unique name to delete.
  * @param[in] version The version of the model to delete.
  */
 void
-MLServiceDB::delete_model (const std::string name, const guint version)
+MLServiceDB::delete_model (const std::string &name, const guint version)
 {
-  char *sql;
   sqlite3_stmt *res;
 
   if (name.empty ())
     throw std::invalid_argument ("Invalid name parameters!");
 
-  std::string key_with_prefix = DB_KEY_PREFIX + std::string ("_model_");
-  key_with_prefix += name;
+  const std::string &key_with_prefix = build_key (DB_KEY_PREFIX "_model_", name);
 
   /* existence check */
   if (!is_model_registered (key_with_prefix, version)) {
@@ -694,28 +1339,29 @@ MLServiceDB::delete_model (const std::string name, const guint version)
                                  + " and version " + std::to_string (version));
   }
 
+  _active_model_cache.erase (key_with_prefix);
+
   if (version > 0U) {
     if (is_model_activated (key_with_prefix, version))
       throw std::invalid_argument ("The model with name " + name
                                    + " and version " + std::to_string (version)
                                    + " is activated, cannot delete it.");
 
-    sql = g_strdup_printf ("DELETE FROM tblModel WHERE key = ?1 and version = %u", version);
+    res = get_stmt ("DELETE FROM tblModel WHERE key = ?1 and version = ?2");
+    if (res && sqlite3_bind_int (res, 2, version) != SQLITE_OK)
+      res = nullptr;
   } else {
-    sql = g_strdup ("DELETE FROM tblModel WHERE key = ?1");
+    res = get_stmt ("DELETE FROM tblModel WHERE key = ?1");
   }
 
-  if (sqlite3_prepare_v2 (_db, sql, -1, &res, nullptr) != SQLITE_OK
-      || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
+  if (!res || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_step (res) != SQLITE_DONE) {
-    sqlite3_finalize (res);
-    g_free (sql);
+    sqlite3_reset (res);
     throw std::runtime_error ("Failed to delete model with name " + name
                               + " and version " + std::to_string (version));
   }
 
-  sqlite3_finalize (res);
-  g_free (sql);
+  sqlite3_reset (res);
 
   if (sqlite3_changes (_db) == 0) {
     throw std::invalid_argument ("There is no model with the given name " + name
@@ -731,33 +1377,30 @@ MLServiceDB::delete_model (const std::string name, const guint version)
  * @param[in] app_info The application information.
  */
 void
-MLServiceDB::set_resource (const std::string name, const std::string path,
-    const std::string description, const std::string app_info)
+MLServiceDB::set_resource (const std::string &name, const std::string &path,
+    const std::string &description, const std::string &app_info)
 {
   sqlite3_stmt *res;
 
   if (name.empty () || path.empty ())
     throw std::invalid_argument ("Invalid name or path parameter!");
 
-  std::string key_with_prefix = DB_KEY_PREFIX + std::string ("_resource_");
-  key_with_prefix += name;
+  const std::string &key_with_prefix = build_key (DB_KEY_PREFIX "_resource_", name);
 
   if (!set_transaction (true))
     throw std::runtime_error ("Failed to begin transaction.");
 
-  if (sqlite3_prepare_v2 (_db,
-          "INSERT OR REPLACE INTO tblResource VALUES (?1, ?2, ?3, ?4)", -1, &res, nullptr)
-          != SQLITE_OK
-      || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
+  res = get_stmt ("INSERT OR REPLACE INTO tblResource VALUES (?1, ?2, ?3, ?4)");
+  if (!res || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_bind_text (res, 2, path.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_bind_text (res, 3, description.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_bind_text (res, 4, app_info.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_step (res) != SQLITE_DONE) {
-    sqlite3_finalize (res);
+    sqlite3_reset (res);
     throw std::runtime_error ("Failed to add the resource " + name);
   }
 
-  sqlite3_finalize (res);
+  sqlite3_reset (res);
 
   if (!set_transaction (false))
     throw std::runtime_error ("Failed to end transaction.");
@@ -775,19 +1418,18 @@ MLServiceDB::set_resource (const std::string name, const std::string path,
  * @param[out] resource The resource corresponding with the given name.
  */
 void
-MLServiceDB::get_resource (const std::string name, gchar **resource)
+MLServiceDB::get_resource (const std::string &name, gchar **resource)
 {
   const char res_info_json[]
       = "json_object('path', path, 'description', description, 'app_info', app_info)";
-  char *sql;
+  g_autofree gchar *sql = nullptr;
   char *value = nullptr;
   sqlite3_stmt *res;
 
   if (name.empty () || !resource)
     throw std::invalid_argument ("Invalid name or resource parameters!");
 
-  std::string key_with_prefix = DB_KEY_PREFIX + std::string ("_resource_");
-  key_with_prefix += name;
+  const std::string &key_with_prefix = build_key (DB_KEY_PREFIX "_resource_", name);
 
   /* existence check */
   if (!is_resource_registered (key_with_prefix))
@@ -797,13 +1439,12 @@ MLServiceDB::get_resource (const std::string name, gchar **resource)
   sql = g_strdup_printf ("SELECT json_group_array(%s) FROM (SELECT * FROM tblResource WHERE key = ?1 ORDER BY ROWID ASC)",
       res_info_json);
 
-  if (sqlite3_prepare_v2 (_db, sql, -1, &res, nullptr) == SQLITE_OK
-      && sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) == SQLITE_OK
+  res = get_stmt (sql);
+  if (res && sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) == SQLITE_OK
       && sqlite3_step (res) == SQLITE_ROW)
-    value = g_strdup_printf ("%s", sqlite3_column_text (res, 0));
+    value = g_strdup ((const gchar *) sqlite3_column_text (res, 0));
 
-  sqlite3_finalize (res);
-  g_free (sql);
+  sqlite3_reset (res);
 
   if (!value)
     throw std::invalid_argument ("Failed to get resource with name " + name);
@@ -816,39 +1457,52 @@ MLServiceDB::get_resource (const std::string name, gchar **resource)
  * @param[in] name The unique name to delete.
  */
 void
-MLServiceDB::delete_resource (const std::string name)
+MLServiceDB::delete_resource (const std::string &name)
 {
-  char *sql;
   sqlite3_stmt *res;
 
   if (name.empty ())
     throw std::invalid_argument ("Invalid name parameters!");
 
-  std::string key_with_prefix = DB_KEY_PREFIX + std::string ("_resource_");
-  key_with_prefix += name;
+  const std::string &key_with_prefix = build_key (DB_KEY_PREFIX "_resource_", name);
 
   /* existence check */
   if (!is_resource_registered (key_with_prefix))
     throw std::invalid_argument ("There is no resource with name " + name);
 
-  sql = g_strdup ("DELETE FROM tblResource WHERE key = ?1");
-
-  if (sqlite3_prepare_v2 (_db, sql, -1, &res, nullptr) != SQLITE_OK
-      || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
+  res = get_stmt ("DELETE FROM tblResource WHERE key = ?1");
+  if (!res || sqlite3_bind_text (res, 1, key_with_prefix.c_str (), -1, nullptr) != SQLITE_OK
       || sqlite3_step (res) != SQLITE_DONE) {
-    sqlite3_finalize (res);
-    g_free (sql);
+    sqlite3_reset (res);
     throw std::runtime_error ("Failed to delete resource with name " + name);
   }
 
-  sqlite3_finalize (res);
-  g_free (sql);
+  sqlite3_reset (res);
 
   if (sqlite3_changes (_db) == 0)
     throw std::invalid_argument ("There is no resource with name " + name);
 }
 
 static MLServiceDB *g_svcdb_instance = nullptr;
+static svcdb_storage_mode_e g_svcdb_storage_mode = SVCDB_STORAGE_DEFAULT;
+static gchar *g_svcdb_config_path = nullptr;
+static guint g_svcdb_maintenance_id = 0;
+static gint g_svcdb_last_use = 0;
+static guint g_svcdb_snapshot_id = 0;
+static gint g_svcdb_snapshot_dirty = 0;
+static GMutex g_svcdb_snapshot_sched_lock;
+
+/**
+ * @brief The debounce delay of the snapshot rewrite in seconds.
+ */
+#define SVCDB_SNAPSHOT_DEBOUNCE (1U)
+
+/**
+ * @brief Lock to serialize the access to the service-db instance.
+ * @note The method invocation handlers run on worker threads (see
+ * gdbus_dispatch_push()), while MLServiceDB itself is not thread-safe.
+ */
+static GMutex g_svcdb_lock;
 
 /**
  * @brief Get the service-db instance.
@@ -857,10 +1511,119 @@ static MLServiceDB *
 svcdb_get (void)
 {
   g_assert (g_svcdb_instance);
+
+  /* Every wrapper passes through here, stamp the last foreground use. */
+  g_atomic_int_set (&g_svcdb_last_use,
+      (gint) (g_get_monotonic_time () / G_USEC_PER_SEC));
   return g_svcdb_instance;
 }
 
+/**
+ * @brief Get the quiet period before idle maintenance runs, in seconds.
+ * @note The period can be adjusted with the ML_AGENT_DB_MAINTENANCE_IDLE
+ * environment variable.
+ */
+static guint
+svcdb_maintenance_idle_period (void)
+{
+  static gsize init = 0;
+  static guint period = SVCDB_MAINTENANCE_IDLE_DEFAULT;
+
+  if (g_once_init_enter (&init)) {
+    const gchar *env = g_getenv ("ML_AGENT_DB_MAINTENANCE_IDLE");
+
+    if (env) {
+      guint64 value = g_ascii_strtoull (env, NULL, 10);
+
+      if (value > 0)
+        period = (guint) value;
+    }
+    g_once_init_leave (&init, 1);
+  }
+
+  return period;
+}
+
+/**
+ * @brief Timeout callback to run the background DB maintenance.
+ * @note The WAL checkpoint runs on every tick so the log cannot grow
+ * without bound under constant load. The vacuum and ANALYZE slice only
+ * runs after the DB has been quiet for the idle period.
+ */
+static gboolean
+svcdb_maintenance_cb (gpointer user_data)
+{
+  gint now = (gint) (g_get_monotonic_time () / G_USEC_PER_SEC);
+  gboolean idle = (now - g_atomic_int_get (&g_svcdb_last_use))
+      >= (gint) svcdb_maintenance_idle_period ();
+
+  g_mutex_lock (&g_svcdb_lock);
+  if (g_svcdb_instance) {
+    g_svcdb_instance->checkpoint ();
+    if (idle)
+      g_svcdb_instance->maintain ();
+  }
+  g_mutex_unlock (&g_svcdb_lock);
+
+  return G_SOURCE_CONTINUE;
+}
+
+/**
+ * @brief Timeout callback to rewrite the read snapshot after writes settle.
+ */
+static gboolean
+svcdb_snapshot_cb (gpointer user_data)
+{
+  g_mutex_lock (&g_svcdb_snapshot_sched_lock);
+  g_svcdb_snapshot_id = 0;
+  g_mutex_unlock (&g_svcdb_snapshot_sched_lock);
+
+  g_mutex_lock (&g_svcdb_lock);
+  /* A write overlapping the dump re-arms the timer and is caught next round. */
+  g_atomic_int_set (&g_svcdb_snapshot_dirty, 0);
+  if (g_svcdb_instance)
+    g_svcdb_instance->write_snapshot ();
+  g_mutex_unlock (&g_svcdb_lock);
+
+  return G_SOURCE_REMOVE;
+}
+
+/**
+ * @brief Mark the read snapshot stale and arm the debounced rewrite.
+ */
+static void
+svcdb_snapshot_schedule (void)
+{
+  g_atomic_int_set (&g_svcdb_snapshot_dirty, 1);
+
+  g_mutex_lock (&g_svcdb_snapshot_sched_lock);
+  if (g_svcdb_snapshot_id == 0) {
+    g_svcdb_snapshot_id = g_timeout_add_seconds (
+        SVCDB_SNAPSHOT_DEBOUNCE, svcdb_snapshot_cb, nullptr);
+  }
+  g_mutex_unlock (&g_svcdb_snapshot_sched_lock);
+}
+
 G_BEGIN_DECLS
+/**
+ * @brief Set the storage mode of the service-db. It should be called before svcdb_initialize().
+ */
+void
+svcdb_set_storage_mode (svcdb_storage_mode_e mode)
+{
+  g_svcdb_storage_mode = mode;
+}
+
+/**
+ * @brief Set the path to the storage configuration file. It should be called before svcdb_initialize().
+ */
+void
+svcdb_set_config_file (const gchar *path)
+{
+  g_free (g_svcdb_config_path);
+  g_svcdb_config_path = g_strdup (path);
+}
+
 /**
  * @brief Initialize the service-db.
  */
@@ -872,8 +1635,42 @@ svcdb_initialize (const gchar *path)
     delete g_svcdb_instance;
   }
 
-  g_svcdb_instance = new MLServiceDB (path);
+  /**
+   * The snapshot of the previous run serves the hot reads while SQLite is
+   * still connecting. It lags a crash by at most the debounce delay; the
+   * rewrite scheduled below refreshes it right after the connect.
+   */
+  svcdb_snapshot_load (path);
+
+  g_svcdb_instance = new MLServiceDB (path, g_svcdb_storage_mode,
+      g_svcdb_config_path ? g_svcdb_config_path : "");
   g_svcdb_instance->connectDB ();
+
+  if (g_svcdb_maintenance_id == 0) {
+    g_svcdb_maintenance_id = g_timeout_add_seconds (
+        SVCDB_MAINTENANCE_INTERVAL, svcdb_maintenance_cb, nullptr);
+  }
+
+  svcdb_snapshot_schedule ();
+}
+
+/**
+ * @brief Initialize the service-db, reporting failure instead of throwing.
+ * @note This is for C callers such as the in-process direct mode of the
+ * client interface, which cannot catch the connect exception.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+gint
+svcdb_initialize_checked (const gchar *path)
+{
+  try {
+    svcdb_initialize (path);
+  } catch (const std::exception &e) {
+    ml_loge ("%s", e.what ());
+    return -EIO;
+  }
+
+  return 0;
 }
 
 /**
@@ -882,12 +1679,56 @@ svcdb_initialize (const gchar *path)
 void
 svcdb_finalize (void)
 {
+  if (g_svcdb_maintenance_id > 0) {
+    g_source_remove (g_svcdb_maintenance_id);
+    g_svcdb_maintenance_id = 0;
+  }
+
+  g_mutex_lock (&g_svcdb_snapshot_sched_lock);
+  if (g_svcdb_snapshot_id > 0) {
+    g_source_remove (g_svcdb_snapshot_id);
+    g_svcdb_snapshot_id = 0;
+  }
+  g_mutex_unlock (&g_svcdb_snapshot_sched_lock);
+
   if (g_svcdb_instance) {
+    /* Leave a fresh snapshot behind for the next cold start. */
+    if (g_atomic_int_get (&g_svcdb_snapshot_dirty)) {
+      g_atomic_int_set (&g_svcdb_snapshot_dirty, 0);
+      g_svcdb_instance->write_snapshot ();
+    }
     g_svcdb_instance->disconnectDB ();
     delete g_svcdb_instance;
   }
 
   g_svcdb_instance = nullptr;
+  svcdb_snapshot_release ();
+}
+
+/**
+ * @brief Get the effective storage configuration of the service-db.
+ * @param[out] config The effective journal mode and pragma values as a comma-separated key=value string.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+gint
+svcdb_config_get (gchar **config)
+{
+  gint ret = 0;
+  MLServiceDB *db = svcdb_get ();
+
+  g_mutex_lock (&g_svcdb_lock);
+  try {
+    db->get_config (config);
+  } catch (const std::invalid_argument &e) {
+    ml_loge ("%s", e.what ());
+    ret = -EINVAL;
+  } catch (const std::exception &e) {
+    ml_loge ("%s", e.what ());
+    ret = -EIO;
+  }
+  g_mutex_unlock (&g_svcdb_lock);
+
+  return ret;
 }
 
 /**
@@ -903,6 +1744,9 @@ svcdb_pipeline_set (const gchar *name, const gchar *description)
   gint ret = 0;
   MLServiceDB *db = svcdb_get ();
 
+  gint64 start = g_get_monotonic_time ();
+
+  g_mutex_lock (&g_svcdb_lock);
   try {
     db->set_pipeline (name, description);
   } catch (const std::invalid_argument &e) {
@@ -913,6 +1757,16 @@ svcdb_pipeline_set (const gchar *name, const gchar *description)
     ret = -EIO;
   }
 
+  /* A throw may leave the transaction of the method open, discard it. */
+  if (ret != 0)
+    db->rollback_transaction ();
+  g_mutex_unlock (&g_svcdb_lock);
+
+  if (ret == 0)
+    svcdb_snapshot_schedule ();
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
+
   return ret;
 }
 
@@ -926,8 +1780,23 @@ gint
 svcdb_pipeline_get (const gchar *name, gchar **description)
 {
   gint ret = 0;
-  MLServiceDB *db = svcdb_get ();
+  MLServiceDB *db;
+
+  gint64 start = g_get_monotonic_time ();
+
+  /* A clean snapshot serves the hot read without touching SQLite. */
+  if (name && description && !g_atomic_int_get (&g_svcdb_snapshot_dirty)) {
+    g_autofree gchar *key = g_strdup_printf (DB_KEY_PREFIX "_pipeline_%s", name);
+
+    if (svcdb_snapshot_lookup (key, description) == 0) {
+      ml_metrics_record (__func__, g_get_monotonic_time () - start);
+      return 0;
+    }
+  }
+
+  db = svcdb_get ();
 
+  g_mutex_lock (&g_svcdb_lock);
   try {
     db->get_pipeline (name, description);
   } catch (const std::invalid_argument &e) {
@@ -937,6 +1806,9 @@ svcdb_pipeline_get (const gchar *name, gchar **description)
     ml_loge ("%s", e.what ());
     ret = -EIO;
   }
+  g_mutex_unlock (&g_svcdb_lock);
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
 
   return ret;
 }
@@ -952,6 +1824,9 @@ svcdb_pipeline_delete (const gchar *name)
   gint ret = 0;
   MLServiceDB *db = svcdb_get ();
 
+  gint64 start = g_get_monotonic_time ();
+
+  g_mutex_lock (&g_svcdb_lock);
   try {
     db->delete_pipeline (name);
   } catch (const std::invalid_argument &e) {
@@ -962,6 +1837,15 @@ svcdb_pipeline_delete (const gchar *name)
     ret = -EIO;
   }
 
+  if (ret != 0)
+    db->rollback_transaction ();
+  g_mutex_unlock (&g_svcdb_lock);
+
+  if (ret == 0)
+    svcdb_snapshot_schedule ();
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
+
   return ret;
 }
 
@@ -982,6 +1866,9 @@ svcdb_model_add (const gchar *name, const gchar *path, const bool is_active,
   gint ret = 0;
   MLServiceDB *db = svcdb_get ();
 
+  gint64 start = g_get_monotonic_time ();
+
+  g_mutex_lock (&g_svcdb_lock);
   try {
     db->set_model (name, path, is_active, description, app_info, version);
   } catch (const std::invalid_argument &e) {
@@ -992,6 +1879,81 @@ svcdb_model_add (const gchar *name, const gchar *path, const bool is_active,
     ret = -EIO;
   }
 
+  if (ret != 0)
+    db->rollback_transaction ();
+  g_mutex_unlock (&g_svcdb_lock);
+
+  if (ret == 0)
+    svcdb_snapshot_schedule ();
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
+
+  return ret;
+}
+
+/**
+ * @brief Add multiple models in a single transaction.
+ * @note Each model file is fingerprinted (a digest of path, size, and mtime).
+ * An entry whose file is unchanged writes no row and reuses its registered
+ * version, so a no-op package update costs one indexed lookup per entry
+ * instead of a write transaction.
+ * @param[in] models The models to be stored, an array of (name, path, is_active, description, app_info).
+ * @param[out] versions The versions of the registered models. On failure, an empty array is returned.
+ * @return @c 0 on success. Otherwise a negative error value. No model is registered on failure.
+ */
+gint
+svcdb_model_add_many (GVariant *models, GVariant **versions)
+{
+  gint ret = 0;
+  MLServiceDB *db = svcdb_get ();
+  GVariantIter iter;
+  GVariantBuilder builder;
+  const gchar *name, *path, *description, *app_info;
+  gboolean is_active;
+
+  if (!models || !versions)
+    return -EINVAL;
+
+  g_variant_builder_init (&builder, G_VARIANT_TYPE ("au"));
+
+  gint64 start = g_get_monotonic_time ();
+
+  g_mutex_lock (&g_svcdb_lock);
+  try {
+    db->begin_transaction ();
+
+    g_variant_iter_init (&iter, models);
+    while (g_variant_iter_next (&iter, "(&s&sb&s&s)", &name, &path,
+        &is_active, &description, &app_info)) {
+      guint version = 0U;
+
+      db->set_model_if_changed (name, path, is_active, description, app_info, &version);
+      g_variant_builder_add (&builder, "u", version);
+    }
+
+    db->end_transaction ();
+  } catch (const std::invalid_argument &e) {
+    ml_loge ("%s", e.what ());
+    ret = -EINVAL;
+  } catch (const std::exception &e) {
+    ml_loge ("%s", e.what ());
+    ret = -EIO;
+  }
+
+  if (ret != 0) {
+    db->rollback_transaction ();
+    g_variant_builder_clear (&builder);
+    *versions = g_variant_new_array (G_VARIANT_TYPE_UINT32, nullptr, 0);
+  } else {
+    *versions = g_variant_builder_end (&builder);
+  }
+  g_mutex_unlock (&g_svcdb_lock);
+
+  if (ret == 0)
+    svcdb_snapshot_schedule ();
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
+
   return ret;
 }
 
@@ -1009,6 +1971,9 @@ svcdb_model_update_description (const gchar *name, const guint version,
   gint ret = 0;
   MLServiceDB *db = svcdb_get ();
 
+  gint64 start = g_get_monotonic_time ();
+
+  g_mutex_lock (&g_svcdb_lock);
   try {
     db->update_model_description (name, version, description);
   } catch (const std::invalid_argument &e) {
@@ -1019,6 +1984,15 @@ svcdb_model_update_description (const gchar *name, const guint version,
     ret = -EIO;
   }
 
+  if (ret != 0)
+    db->rollback_transaction ();
+  g_mutex_unlock (&g_svcdb_lock);
+
+  if (ret == 0)
+    svcdb_snapshot_schedule ();
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
+
   return ret;
 }
 
@@ -1034,6 +2008,9 @@ svcdb_model_activate (const gchar *name, const guint version)
   gint ret = 0;
   MLServiceDB *db = svcdb_get ();
 
+  gint64 start = g_get_monotonic_time ();
+
+  g_mutex_lock (&g_svcdb_lock);
   try {
     db->activate_model (name, version);
   } catch (const std::invalid_argument &e) {
@@ -1044,6 +2021,15 @@ svcdb_model_activate (const gchar *name, const guint version)
     ret = -EIO;
   }
 
+  if (ret != 0)
+    db->rollback_transaction ();
+  g_mutex_unlock (&g_svcdb_lock);
+
+  if (ret == 0)
+    svcdb_snapshot_schedule ();
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
+
   return ret;
 }
 
@@ -1060,6 +2046,9 @@ svcdb_model_get (const gchar *name, const guint version, gchar **model_info)
   gint ret = 0;
   MLServiceDB *db = svcdb_get ();
 
+  gint64 start = g_get_monotonic_time ();
+
+  g_mutex_lock (&g_svcdb_lock);
   try {
     db->get_model (name, version, model_info);
   } catch (const std::invalid_argument &e) {
@@ -1069,6 +2058,9 @@ svcdb_model_get (const gchar *name, const guint version, gchar **model_info)
     ml_loge ("%s", e.what ());
     ret = -EIO;
   }
+  g_mutex_unlock (&g_svcdb_lock);
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
 
   return ret;
 }
@@ -1083,8 +2075,23 @@ gint
 svcdb_model_get_activated (const gchar *name, gchar **model_info)
 {
   gint ret = 0;
-  MLServiceDB *db = svcdb_get ();
+  MLServiceDB *db;
+
+  gint64 start = g_get_monotonic_time ();
+
+  /* A clean snapshot serves the hot read without touching SQLite. */
+  if (name && model_info && !g_atomic_int_get (&g_svcdb_snapshot_dirty)) {
+    g_autofree gchar *key = g_strdup_printf (DB_KEY_PREFIX "_model_%s", name);
+
+    if (svcdb_snapshot_lookup (key, model_info) == 0) {
+      ml_metrics_record (__func__, g_get_monotonic_time () - start);
+      return 0;
+    }
+  }
 
+  db = svcdb_get ();
+
+  g_mutex_lock (&g_svcdb_lock);
   try {
     db->get_model (name, -1, model_info);
   } catch (const std::invalid_argument &e) {
@@ -1094,6 +2101,9 @@ svcdb_model_get_activated (const gchar *name, gchar **model_info)
     ml_loge ("%s", e.what ());
     ret = -EIO;
   }
+  g_mutex_unlock (&g_svcdb_lock);
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
 
   return ret;
 }
@@ -1110,6 +2120,9 @@ svcdb_model_get_all (const gchar *name, gchar **model_info)
   gint ret = 0;
   MLServiceDB *db = svcdb_get ();
 
+  gint64 start = g_get_monotonic_time ();
+
+  g_mutex_lock (&g_svcdb_lock);
   try {
     db->get_model (name, 0, model_info);
   } catch (const std::invalid_argument &e) {
@@ -1119,6 +2132,44 @@ svcdb_model_get_all (const gchar *name, gchar **model_info)
     ml_loge ("%s", e.what ());
     ret = -EIO;
   }
+  g_mutex_unlock (&g_svcdb_lock);
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
+
+  return ret;
+}
+
+/**
+ * @brief List the registered models page by page.
+ * @param[in] filter The SQL LIKE pattern to match model names. An empty string matches all models.
+ * @param[in] active_state Filter on the active flag. 1 for active models only, 0 for inactive only, -1 for any.
+ * @param[in] offset The number of matching rows to skip.
+ * @param[in] limit The maximum number of rows in the page. It should be a positive integer.
+ * @param[out] model_list The JSON array with the page of models.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+gint
+svcdb_model_list (const gchar *filter, const gint active_state,
+    const guint offset, const guint limit, gchar **model_list)
+{
+  gint ret = 0;
+  MLServiceDB *db = svcdb_get ();
+
+  gint64 start = g_get_monotonic_time ();
+
+  g_mutex_lock (&g_svcdb_lock);
+  try {
+    db->list_models (filter ? filter : "", active_state, offset, limit, model_list);
+  } catch (const std::invalid_argument &e) {
+    ml_loge ("%s", e.what ());
+    ret = -EINVAL;
+  } catch (const std::exception &e) {
+    ml_loge ("%s", e.what ());
+    ret = -EIO;
+  }
+  g_mutex_unlock (&g_svcdb_lock);
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
 
   return ret;
 }
@@ -1135,6 +2186,9 @@ svcdb_model_delete (const gchar *name, const guint version)
   gint ret = 0;
   MLServiceDB *db = svcdb_get ();
 
+  gint64 start = g_get_monotonic_time ();
+
+  g_mutex_lock (&g_svcdb_lock);
   try {
     db->delete_model (name, version);
   } catch (const std::invalid_argument &e) {
@@ -1145,6 +2199,15 @@ svcdb_model_delete (const gchar *name, const guint version)
     ret = -EIO;
   }
 
+  if (ret != 0)
+    db->rollback_transaction ();
+  g_mutex_unlock (&g_svcdb_lock);
+
+  if (ret == 0)
+    svcdb_snapshot_schedule ();
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
+
   return ret;
 }
 
@@ -1163,6 +2226,9 @@ svcdb_resource_add (const gchar *name, const gchar *path,
   gint ret = 0;
   MLServiceDB *db = svcdb_get ();
 
+  gint64 start = g_get_monotonic_time ();
+
+  g_mutex_lock (&g_svcdb_lock);
   try {
     db->set_resource (name, path, description, app_info);
   } catch (const std::invalid_argument &e) {
@@ -1173,6 +2239,57 @@ svcdb_resource_add (const gchar *name, const gchar *path,
     ret = -EIO;
   }
 
+  if (ret != 0)
+    db->rollback_transaction ();
+  g_mutex_unlock (&g_svcdb_lock);
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
+
+  return ret;
+}
+
+/**
+ * @brief Add multiple resources in a single transaction.
+ * @param[in] resources The resources to be stored, an array of (name, path, description, app_info).
+ * @return @c 0 on success. Otherwise a negative error value. No resource is added on failure.
+ */
+gint
+svcdb_resource_add_many (GVariant *resources)
+{
+  gint ret = 0;
+  MLServiceDB *db = svcdb_get ();
+  GVariantIter iter;
+  const gchar *name, *path, *description, *app_info;
+
+  if (!resources)
+    return -EINVAL;
+
+  gint64 start = g_get_monotonic_time ();
+
+  g_mutex_lock (&g_svcdb_lock);
+  try {
+    db->begin_transaction ();
+
+    g_variant_iter_init (&iter, resources);
+    while (g_variant_iter_next (&iter, "(&s&s&s&s)", &name, &path, &description, &app_info)) {
+      db->set_resource (name, path, description, app_info);
+    }
+
+    db->end_transaction ();
+  } catch (const std::invalid_argument &e) {
+    ml_loge ("%s", e.what ());
+    ret = -EINVAL;
+  } catch (const std::exception &e) {
+    ml_loge ("%s", e.what ());
+    ret = -EIO;
+  }
+
+  if (ret != 0)
+    db->rollback_transaction ();
+  g_mutex_unlock (&g_svcdb_lock);
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
+
   return ret;
 }
 
@@ -1188,6 +2305,9 @@ svcdb_resource_get (const gchar *name, gchar **res_info)
   gint ret = 0;
   MLServiceDB *db = svcdb_get ();
 
+  gint64 start = g_get_monotonic_time ();
+
+  g_mutex_lock (&g_svcdb_lock);
   try {
     db->get_resource (name, res_info);
   } catch (const std::invalid_argument &e) {
@@ -1197,6 +2317,9 @@ svcdb_resource_get (const gchar *name, gchar **res_info)
     ml_loge ("%s", e.what ());
     ret = -EIO;
   }
+  g_mutex_unlock (&g_svcdb_lock);
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
 
   return ret;
 }
@@ -1212,6 +2335,9 @@ svcdb_resource_delete (const gchar *name)
   gint ret = 0;
   MLServiceDB *db = svcdb_get ();
 
+  gint64 start = g_get_monotonic_time ();
+
+  g_mutex_lock (&g_svcdb_lock);
   try {
     db->delete_resource (name);
   } catch (const std::invalid_argument &e) {
@@ -1222,6 +2348,12 @@ svcdb_resource_delete (const gchar *name)
     ret = -EIO;
   }
 
+  if (ret != 0)
+    db->rollback_transaction ();
+  g_mutex_unlock (&g_svcdb_lock);
+
+  ml_metrics_record (__func__, g_get_monotonic_time () - start);
+
   return ret;
 }
 G_END_DECLS
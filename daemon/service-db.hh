@@ -16,6 +16,9 @@
 #include <glib.h>
 #include <iostream>
 #include <sqlite3.h>
+#include <unordered_map>
+
+#include "service-db-util.h"
 
 /**
  * @brief Class for ML-Service Database.
@@ -30,37 +33,65 @@ class MLServiceDB
 
   virtual void connectDB ();
   virtual void disconnectDB ();
-  virtual void set_pipeline (const std::string name, const std::string description);
-  virtual void get_pipeline (const std::string name, gchar **description);
-  virtual void delete_pipeline (const std::string name);
-  virtual void set_model (const std::string name, const std::string model, const bool is_active,
-      const std::string description, const std::string app_info, guint *version);
-  virtual void update_model_description (const std::string name,
-      const guint version, const std::string description);
-  virtual void activate_model (const std::string name, const guint version);
-  virtual void get_model (const std::string name, const gint version, gchar **model);
-  virtual void delete_model (const std::string name, const guint version);
-  virtual void set_resource (const std::string name, const std::string path,
-      const std::string description, const std::string app_info);
-  virtual void get_resource (const std::string name, gchar **resource);
-  virtual void delete_resource (const std::string name);
+  virtual void checkpoint ();
+  virtual void maintain ();
+  virtual void write_snapshot ();
+  virtual void get_config (gchar **config);
+  virtual void begin_transaction ();
+  virtual void end_transaction ();
+  virtual void rollback_transaction ();
+  virtual void set_pipeline (const std::string &name, const std::string &description);
+  virtual void get_pipeline (const std::string &name, gchar **description);
+  virtual void delete_pipeline (const std::string &name);
+  virtual void set_model (const std::string &name, const std::string &model, const bool is_active,
+      const std::string &description, const std::string &app_info, guint *version);
+  virtual void set_model_if_changed (const std::string &name, const std::string &model,
+      const bool is_active, const std::string &description,
+      const std::string &app_info, guint *version);
+  virtual void update_model_description (const std::string &name,
+      const guint version, const std::string &description);
+  virtual void activate_model (const std::string &name, const guint version);
+  virtual void get_model (const std::string &name, const gint version, gchar **model);
+  virtual void list_models (const std::string &filter, const gint active_state,
+      const guint offset, const guint limit, gchar **model_list);
+  virtual void delete_model (const std::string &name, const guint version);
+  virtual void set_resource (const std::string &name, const std::string &path,
+      const std::string &description, const std::string &app_info);
+  virtual void get_resource (const std::string &name, gchar **resource);
+  virtual void delete_resource (const std::string &name);
 
-  MLServiceDB (std::string path);
+  MLServiceDB (std::string path, svcdb_storage_mode_e storage_mode = SVCDB_STORAGE_DEFAULT,
+      std::string config_path = "");
   virtual ~MLServiceDB ();
 
   private:
   void initDB ();
-  int get_table_version (const std::string tbl_name, const int default_ver);
-  bool set_table_version (const std::string tbl_name, const int tbl_ver);
-  bool create_table (const std::string tbl_name);
+  void apply_config ();
+  int get_table_version (const std::string &tbl_name, const int default_ver);
+  bool set_table_version (const std::string &tbl_name, const int tbl_ver);
+  bool create_table (const std::string &tbl_name);
+  bool create_index (const std::string &idx_name);
+  bool migrate_model_table (const int from_ver);
   bool set_transaction (bool begin);
-  bool is_model_registered (const std::string key, const guint version);
-  bool is_model_activated (const std::string key, const guint version);
-  bool is_resource_registered (const std::string key);
+  const std::string &build_key (const char *prefix, const std::string &name);
+  std::string get_model_fingerprint (const std::string &path);
+  bool is_model_registered (const std::string &key, const guint version);
+  bool is_model_activated (const std::string &key, const guint version);
+  bool is_resource_registered (const std::string &key);
+  sqlite3_stmt *get_stmt (const std::string &sql);
+  void clear_stmt_cache ();
 
   std::string _path;
+  std::string _config_path;
+  std::string _config_desc;
   bool _initialized;
+  svcdb_storage_mode_e _storage_mode;
+  int _tx_depth;
   sqlite3 *_db;
+  std::string _key_buf;
+  std::unordered_map<std::string, sqlite3_stmt *> _stmt_cache;
+  std::unordered_map<std::string, std::string> _active_model_cache;
+  std::unordered_map<std::string, std::string> _pipeline_cache;
 };
 
 #endif /* __SERVICE_DB_HH__ */
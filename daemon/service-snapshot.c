@@ -0,0 +1,213 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ *
+ * @file    service-snapshot.c
+ * @date    27 Aug 2026
+ * @brief   Memory-mapped read snapshot of the ML service DB
+ * @see     https://github.com/nnstreamer/deviceMLOps.MLAgent
+ * @author  Sangjung Woo <sangjung.woo@samsung.com>
+ * @bug     No known bugs except for NYI items
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <glib/gstdio.h>
+
+#include "service-snapshot.h"
+#include "log.h"
+
+/**
+ * @brief The name of the snapshot file inside the DB directory.
+ */
+#define SNAPSHOT_FILE_NAME ".ml-service.snap"
+
+/**
+ * @brief The magic number of the snapshot file ('M' 'L' 'S' 'S').
+ */
+#define SNAPSHOT_MAGIC (0x4d4c5353U)
+
+/**
+ * @brief The format version of the snapshot file.
+ */
+#define SNAPSHOT_VERSION (1U)
+
+/**
+ * @brief The header of the snapshot file. Records follow as pairs of
+ * guint32 lengths (including the terminating null) and the raw bytes of
+ * the key and the value.
+ */
+struct snapshot_header
+{
+  guint32 magic;    /**< SNAPSHOT_MAGIC */
+  guint32 version;  /**< SNAPSHOT_VERSION */
+  guint32 count;    /**< the number of records */
+  guint32 reserved; /**< reserved, written as zero */
+};
+
+static GMappedFile *g_snapshot_map = NULL;
+G_LOCK_DEFINE_STATIC (snapshot_lock);
+
+/**
+ * @brief Get the path of the snapshot file of the given DB directory.
+ */
+static gchar *
+snapshot_path (const gchar *dir)
+{
+  return g_build_filename (dir, SNAPSHOT_FILE_NAME, NULL);
+}
+
+/**
+ * @brief Map the snapshot file of the given DB directory read-only.
+ */
+gint
+svcdb_snapshot_load (const gchar *dir)
+{
+  g_autofree gchar *path = snapshot_path (dir);
+  const struct snapshot_header *header;
+  GMappedFile *map;
+
+  map = g_mapped_file_new (path, FALSE, NULL);
+  if (!map)
+    return -ENOENT;
+
+  if (g_mapped_file_get_length (map) < sizeof (struct snapshot_header)) {
+    g_mapped_file_unref (map);
+    return -ENOENT;
+  }
+
+  header = (const struct snapshot_header *) g_mapped_file_get_contents (map);
+  if (header->magic != SNAPSHOT_MAGIC || header->version != SNAPSHOT_VERSION) {
+    ml_logw ("The snapshot '%s' has an unknown format, ignore it.", path);
+    g_mapped_file_unref (map);
+    return -ENOENT;
+  }
+
+  G_LOCK (snapshot_lock);
+  if (g_snapshot_map)
+    g_mapped_file_unref (g_snapshot_map);
+  g_snapshot_map = map;
+  G_UNLOCK (snapshot_lock);
+
+  return 0;
+}
+
+/**
+ * @brief Unmap the snapshot mapped with svcdb_snapshot_load().
+ */
+void
+svcdb_snapshot_release (void)
+{
+  G_LOCK (snapshot_lock);
+  if (g_snapshot_map) {
+    g_mapped_file_unref (g_snapshot_map);
+    g_snapshot_map = NULL;
+  }
+  G_UNLOCK (snapshot_lock);
+}
+
+/**
+ * @brief Look the given DB key up in the mapped snapshot.
+ */
+gint
+svcdb_snapshot_lookup (const gchar *key, gchar **value)
+{
+  const struct snapshot_header *header;
+  const gchar *cursor, *end;
+  gsize key_len;
+  guint32 i;
+  gint ret = -ENOENT;
+
+  if (!key || !value)
+    return -EINVAL;
+
+  G_LOCK (snapshot_lock);
+  if (!g_snapshot_map) {
+    G_UNLOCK (snapshot_lock);
+    return -ENOENT;
+  }
+
+  header = (const struct snapshot_header *) g_mapped_file_get_contents (g_snapshot_map);
+  cursor = (const gchar *) (header + 1);
+  end = (const gchar *) header + g_mapped_file_get_length (g_snapshot_map);
+  key_len = strlen (key) + 1;
+
+  for (i = 0; i < header->count; i++) {
+    guint32 lens[2];
+
+    if (cursor + sizeof (lens) > end)
+      break;
+    memcpy (lens, cursor, sizeof (lens));
+    cursor += sizeof (lens);
+
+    if (lens[0] == 0 || lens[1] == 0 || cursor + lens[0] + lens[1] > end)
+      break;
+
+    if (lens[0] == key_len && memcmp (cursor, key, key_len) == 0
+        && cursor[lens[0] + lens[1] - 1] == '\0') {
+      *value = g_strdup (cursor + lens[0]);
+      ret = 0;
+      break;
+    }
+
+    cursor += lens[0] + lens[1];
+  }
+  G_UNLOCK (snapshot_lock);
+
+  return ret;
+}
+
+/**
+ * @brief Append one record to the serialized snapshot content.
+ */
+static void
+snapshot_append (gpointer key, gpointer value, gpointer user_data)
+{
+  GByteArray *content = (GByteArray *) user_data;
+  guint32 lens[2];
+
+  lens[0] = (guint32) strlen ((const gchar *) key) + 1U;
+  lens[1] = (guint32) strlen ((const gchar *) value) + 1U;
+
+  g_byte_array_append (content, (const guint8 *) lens, sizeof (lens));
+  g_byte_array_append (content, (const guint8 *) key, lens[0]);
+  g_byte_array_append (content, (const guint8 *) value, lens[1]);
+}
+
+/**
+ * @brief Rewrite the snapshot file atomically and remap it.
+ */
+gint
+svcdb_snapshot_store (const gchar *dir, GHashTable *entries)
+{
+  g_autofree gchar *path = NULL;
+  g_autoptr (GError) err = NULL;
+  GByteArray *content;
+  struct snapshot_header header;
+  gint ret;
+
+  if (!dir || !entries)
+    return -EINVAL;
+
+  header.magic = SNAPSHOT_MAGIC;
+  header.version = SNAPSHOT_VERSION;
+  header.count = g_hash_table_size (entries);
+  header.reserved = 0U;
+
+  content = g_byte_array_new ();
+  g_byte_array_append (content, (const guint8 *) &header, sizeof (header));
+  g_hash_table_foreach (entries, snapshot_append, content);
+
+  /* g_file_set_contents writes to a temporary file and renames it over. */
+  path = snapshot_path (dir);
+  if (g_file_set_contents (path, (const gchar *) content->data, content->len, &err)) {
+    ret = svcdb_snapshot_load (dir);
+  } else {
+    ml_logw ("Failed to write the snapshot '%s': %s", path, err->message);
+    ret = -EIO;
+  }
+
+  g_byte_array_free (content, TRUE);
+  return ret;
+}
@@ -0,0 +1,59 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+/**
+ * NNStreamer API / Machine Learning Agent Daemon
+ * Copyright (C) 2026 Samsung Electronics Co., Ltd. All Rights Reserved.
+ */
+
+/**
+ * @file    service-snapshot.h
+ * @date    27 Aug 2026
+ * @brief   Memory-mapped read snapshot of the ML service DB
+ * @see     https://github.com/nnstreamer/deviceMLOps.MLAgent
+ * @author  Sangjung Woo <sangjung.woo@samsung.com>
+ * @bug     No known bugs except for NYI items
+ *
+ * @details
+ *    This keeps a compact flat file next to the service DB holding the
+ *    pipeline descriptions and the activated model of each key. The file
+ *    is rewritten atomically after write transactions (debounced by the
+ *    svcdb layer) and mapped read-only by svcdb_snapshot_load(), so the
+ *    hot read calls can be served with O(page-fault) lookups before
+ *    SQLite is even open.
+ */
+#ifndef __SERVICE_SNAPSHOT_H__
+#define __SERVICE_SNAPSHOT_H__
+
+#include <glib.h>
+
+G_BEGIN_DECLS
+
+/**
+ * @brief Map the snapshot file of the given DB directory read-only.
+ * @param dir The directory holding the service DB.
+ * @return @c 0 on success. -ENOENT if there is no usable snapshot.
+ */
+gint svcdb_snapshot_load (const gchar *dir);
+
+/**
+ * @brief Unmap the snapshot mapped with svcdb_snapshot_load().
+ */
+void svcdb_snapshot_release (void);
+
+/**
+ * @brief Look the given DB key up in the mapped snapshot.
+ * @param key The prefixed DB key of the entry.
+ * @param value The value of the entry. Caller should release it using g_free().
+ * @return @c 0 on success. -ENOENT if the snapshot is not mapped or has no such key.
+ */
+gint svcdb_snapshot_lookup (const gchar *key, gchar **value);
+
+/**
+ * @brief Rewrite the snapshot file atomically and remap it.
+ * @param dir The directory holding the service DB.
+ * @param entries The table of prefixed DB keys and their values.
+ * @return @c 0 on success. Otherwise a negative error value.
+ */
+gint svcdb_snapshot_store (const gchar *dir, GHashTable *entries);
+
+G_END_DECLS
+#endif /* __SERVICE_SNAPSHOT_H__ */
@@ -0,0 +1,278 @@
+/**
+ * @file        benchmark_service_db.cc
+ * @date        27 Aug 2026
+ * @brief       Microbenchmark for service DB and the D-Bus hot paths of ML Agent
+ * @see         https://github.com/nnstreamer/deviceMLOps.MLAgent
+ * @author      Sangjung Woo <sangjung.woo@samsung.com>
+ * @bug         No known bugs
+ *
+ * @details
+ *    This measures ops/sec and p50/p99 latency of each svcdb_* entry point
+ *    at varying model-table sizes, plus the D-Bus round trip of the
+ *    ml_agent_* client API when the agent daemon is reachable.
+ *    Each result is printed as one machine-readable line:
+ *      BENCH,<name>,rows=<n>,iters=<n>,ops_per_sec=<n>,p50_us=<n>,p99_us=<n>
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <glib.h>
+#include <glib/gstdio.h>
+
+#include "log.h"
+#include "mlops-agent-interface.h"
+#include "service-db-util.h"
+
+/**
+ * @brief The number of measured iterations of each benchmark case.
+ */
+#define BENCH_ITERS (1000U)
+
+/**
+ * @brief The model-table sizes to benchmark against.
+ */
+static const guint table_sizes[] = { 10U, 1000U, 100000U };
+
+/**
+ * @brief Function to run one iteration of a benchmark case.
+ */
+typedef void (*bench_func) (guint iter, guint rows);
+
+/**
+ * @brief Run one benchmark case and print the machine-readable result line.
+ */
+static void
+run_bench (const gchar *name, guint rows, guint iters, bench_func func)
+{
+  std::vector<gint64> latencies (iters);
+  gint64 start, total = 0;
+  guint i;
+
+  for (i = 0; i < iters; i++) {
+    start = g_get_monotonic_time ();
+    func (i, rows);
+    latencies[i] = g_get_monotonic_time () - start;
+    total += latencies[i];
+  }
+
+  std::sort (latencies.begin (), latencies.end ());
+
+  g_print ("BENCH,%s,rows=%u,iters=%u,ops_per_sec=%.1f,p50_us=%" G_GINT64_FORMAT
+           ",p99_us=%" G_GINT64_FORMAT "\n",
+      name, rows, iters, iters * 1000000.0 / (gdouble) MAX (total, 1),
+      latencies[iters / 2], latencies[(guint) (iters * 0.99)]);
+}
+
+/**
+ * @brief Fill the model table up to the given number of rows.
+ */
+static void
+populate_models (guint from, guint to)
+{
+  GVariantBuilder builder;
+  GVariant *models, *versions = NULL;
+  guint i;
+
+  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a(ssbss)"));
+  for (i = from; i < to; i++) {
+    g_autofree gchar *name = g_strdup_printf ("bench_model_%u", i);
+    g_autofree gchar *path = g_strdup_printf ("/opt/bench/model_%u.tflite", i);
+
+    g_variant_builder_add (&builder, "(ssbss)", name, path, TRUE, "benchmark model", "");
+  }
+
+  models = g_variant_ref_sink (g_variant_builder_end (&builder));
+  if (svcdb_model_add_many (models, &versions) != 0)
+    g_error ("Failed to populate the model table with %u rows.", to);
+
+  g_variant_unref (models);
+  if (versions)
+    g_variant_unref (g_variant_ref_sink (versions));
+}
+
+/**
+ * @brief One iteration of the model-get benchmark.
+ */
+static void
+bench_model_get (guint iter, guint rows)
+{
+  g_autofree gchar *name = g_strdup_printf ("bench_model_%u", iter % rows);
+  g_autofree gchar *model_info = NULL;
+
+  if (svcdb_model_get (name, 1U, &model_info) != 0)
+    g_error ("svcdb_model_get failed for '%s'.", name);
+}
+
+/**
+ * @brief One iteration of the activated-model-get benchmark.
+ */
+static void
+bench_model_get_activated (guint iter, guint rows)
+{
+  g_autofree gchar *name = g_strdup_printf ("bench_model_%u", iter % rows);
+  g_autofree gchar *model_info = NULL;
+
+  if (svcdb_model_get_activated (name, &model_info) != 0)
+    g_error ("svcdb_model_get_activated failed for '%s'.", name);
+}
+
+/**
+ * @brief One iteration of the model-activate benchmark.
+ */
+static void
+bench_model_activate (guint iter, guint rows)
+{
+  g_autofree gchar *name = g_strdup_printf ("bench_model_%u", iter % rows);
+
+  if (svcdb_model_activate (name, 1U) != 0)
+    g_error ("svcdb_model_activate failed for '%s'.", name);
+}
+
+/**
+ * @brief One iteration of the model-add benchmark, appending new versions.
+ */
+static void
+bench_model_add (guint iter, guint rows)
+{
+  g_autofree gchar *name = g_strdup_printf ("bench_model_%u", iter % rows);
+  g_autofree gchar *path = g_strdup_printf ("/opt/bench/model_v%u.tflite", iter);
+  guint version = 0U;
+
+  if (svcdb_model_add (name, path, FALSE, "benchmark add", "", &version) != 0)
+    g_error ("svcdb_model_add failed for '%s'.", name);
+}
+
+/**
+ * @brief One iteration of the pipeline-set benchmark.
+ */
+static void
+bench_pipeline_set (guint iter, guint rows)
+{
+  g_autofree gchar *name = g_strdup_printf ("bench_pipeline_%u", iter % rows);
+
+  if (svcdb_pipeline_set (name, "videotestsrc ! fakesink") != 0)
+    g_error ("svcdb_pipeline_set failed for '%s'.", name);
+}
+
+/**
+ * @brief One iteration of the pipeline-get benchmark.
+ */
+static void
+bench_pipeline_get (guint iter, guint rows)
+{
+  g_autofree gchar *name = g_strdup_printf ("bench_pipeline_%u", iter % rows);
+  g_autofree gchar *description = NULL;
+
+  if (svcdb_pipeline_get (name, &description) != 0)
+    g_error ("svcdb_pipeline_get failed for '%s'.", name);
+}
+
+/**
+ * @brief One iteration of the resource-add benchmark.
+ */
+static void
+bench_resource_add (guint iter, guint rows)
+{
+  g_autofree gchar *name = g_strdup_printf ("bench_resource_%u", iter % rows);
+  g_autofree gchar *path = g_strdup_printf ("/opt/bench/resource_%u.dat", iter);
+
+  if (svcdb_resource_add (name, path, "benchmark resource", "") != 0)
+    g_error ("svcdb_resource_add failed for '%s'.", name);
+}
+
+/**
+ * @brief One iteration of the resource-get benchmark.
+ */
+static void
+bench_resource_get (guint iter, guint rows)
+{
+  g_autofree gchar *name = g_strdup_printf ("bench_resource_%u", iter % rows);
+  g_autofree gchar *res_info = NULL;
+
+  if (svcdb_resource_get (name, &res_info) != 0)
+    g_error ("svcdb_resource_get failed for '%s'.", name);
+}
+
+/**
+ * @brief One iteration of the D-Bus round-trip benchmark via the client API.
+ */
+static void
+bench_dbus_pipeline_get (guint iter, guint rows)
+{
+  g_autofree gchar *description = NULL;
+
+  if (ml_agent_pipeline_get_description ("bench_pipeline_0", &description, NULL) != 0)
+    g_error ("ml_agent_pipeline_get_description failed.");
+}
+
+/**
+ * @brief Benchmark the D-Bus round trip when the agent daemon is reachable.
+ */
+static void
+run_dbus_bench (void)
+{
+  gchar *description = NULL;
+
+  if (ml_agent_pipeline_set_description ("bench_pipeline_0",
+          "videotestsrc ! fakesink", NULL) != 0 ||
+      ml_agent_pipeline_get_description ("bench_pipeline_0", &description, NULL) != 0) {
+    g_print ("BENCH,ml_agent_pipeline_get_description,skipped=1\n");
+    return;
+  }
+  g_free (description);
+
+  run_bench ("ml_agent_pipeline_get_description", 1U, BENCH_ITERS, bench_dbus_pipeline_get);
+  ml_agent_pipeline_delete ("bench_pipeline_0", NULL);
+}
+
+/**
+ * @brief Main routine of the benchmark.
+ */
+int
+main (int argc, char **argv)
+{
+  g_autofree gchar *db_dir = NULL;
+  guint populated = 0U;
+  size_t i;
+
+  db_dir = g_dir_make_tmp ("ml_agent_bench_XXXXXX", NULL);
+  if (!db_dir) {
+    g_printerr ("Failed to create a temporary directory for the database.\n");
+    return 1;
+  }
+
+  svcdb_initialize (db_dir);
+
+  for (i = 0; i < G_N_ELEMENTS (table_sizes); i++) {
+    const guint rows = table_sizes[i];
+
+    populate_models (populated, rows);
+    populated = rows;
+
+    run_bench ("svcdb_model_get", rows, BENCH_ITERS, bench_model_get);
+    run_bench ("svcdb_model_get_activated", rows, BENCH_ITERS, bench_model_get_activated);
+    run_bench ("svcdb_model_activate", rows, BENCH_ITERS, bench_model_activate);
+    run_bench ("svcdb_model_add", rows, BENCH_ITERS, bench_model_add);
+    run_bench ("svcdb_pipeline_set", rows, BENCH_ITERS, bench_pipeline_set);
+    run_bench ("svcdb_pipeline_get", rows, BENCH_ITERS, bench_pipeline_get);
+    run_bench ("svcdb_resource_add", rows, BENCH_ITERS, bench_resource_add);
+    run_bench ("svcdb_resource_get", rows, BENCH_ITERS, bench_resource_get);
+  }
+
+  svcdb_finalize ();
+
+  run_dbus_bench ();
+
+  {
+    static const gchar *db_files[] = { ".ml-service.db", ".ml-service.db-wal", ".ml-service.db-shm" };
+
+    for (i = 0; i < G_N_ELEMENTS (db_files); i++) {
+      g_autofree gchar *db_file = g_build_filename (db_dir, db_files[i], NULL);
+      g_unlink (db_file);
+    }
+    g_rmdir (db_dir);
+  }
+
+  return 0;
+}
@@ -0,0 +1,499 @@
+/**
+ * @file        loadtest_mlops_agent.cc
+ * @date        27 Aug 2026
+ * @brief       Multi-client load and soak harness for the ML Agent daemon
+ * @see         https://github.com/nnstreamer/deviceMLOps.MLAgent
+ * @author      Sangjung Woo <sangjung.woo@samsung.com>
+ * @bug         No known bugs
+ *
+ * @details
+ *    This spawns N client processes issuing a configurable mix of
+ *    ml_agent_* calls against a running agent daemon for a set duration,
+ *    then merges the per-client samples. Each result is printed as one
+ *    machine-readable line:
+ *      LOAD,<method>,clients=<n>,count=<n>,errs=<n>,ops_per_sec=<n>,
+ *          p50_us=<n>,p95_us=<n>,p99_us=<n>,max_us=<n>
+ *    The daemon RSS is sampled once per second while the clients run:
+ *      LOAD_RSS,t_s=<n>,rss_kb=<n>
+ *    Without a reachable daemon the harness prints LOAD,skipped=1 and
+ *    exits cleanly, like the D-Bus cases of benchmark_service_db.
+ */
+
+#include <algorithm>
+#include <vector>
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <glib.h>
+#include <glib/gstdio.h>
+
+#include "mlops-agent-interface.h"
+
+/**
+ * @brief The default number of client processes.
+ */
+#define LOAD_DEFAULT_CLIENTS (8)
+
+/**
+ * @brief The default run duration in seconds.
+ */
+#define LOAD_DEFAULT_DURATION (30)
+
+/**
+ * @brief The default call mix as <method>:<weight> pairs.
+ */
+#define LOAD_DEFAULT_MIX \
+  "model_get:40,pipeline_get:25,model_list:10,pipeline_set:10,model_register:10,pipeline_launch:5"
+
+static gint opt_clients = LOAD_DEFAULT_CLIENTS;
+static gint opt_duration = LOAD_DEFAULT_DURATION;
+static gchar *opt_mix = NULL;
+static gint opt_daemon_pid = 0;
+
+/**
+ * @brief Function to run one call of a load-mix method.
+ * @return 0 on success. Otherwise a negative error value.
+ */
+typedef gint (*load_op_func) (guint iter);
+
+/**
+ * @brief One call of the activated-model query, the most common client call.
+ */
+static gint
+op_model_get (guint iter)
+{
+  g_autofree gchar *model_info = NULL;
+
+  return ml_agent_model_get_activated ("load_model_0", &model_info, NULL);
+}
+
+/**
+ * @brief One call of the paged model listing.
+ */
+static gint
+op_model_list (guint iter)
+{
+  g_autofree gchar *model_list = NULL;
+
+  return ml_agent_model_list ("load_model_%", -1, 0U, 50U, &model_list, NULL);
+}
+
+/**
+ * @brief One call of model registration. Versions of a per-client name
+ * accumulate over the run, growing the DB like a long soak would.
+ */
+static gint
+op_model_register (guint iter)
+{
+  g_autofree gchar *name = g_strdup_printf ("load_model_c%d", (gint) getpid ());
+  g_autofree gchar *path = g_strdup_printf ("/opt/load/model_%u.tflite", iter);
+  guint version = 0U;
+
+  return ml_agent_model_register (name, path, FALSE, "load model", "", &version, NULL);
+}
+
+/**
+ * @brief One call of the pipeline description query.
+ */
+static gint
+op_pipeline_get (guint iter)
+{
+  g_autofree gchar *description = NULL;
+
+  return ml_agent_pipeline_get_description ("load_pipeline_0", &description, NULL);
+}
+
+/**
+ * @brief One call of the pipeline description update on a per-client name.
+ */
+static gint
+op_pipeline_set (guint iter)
+{
+  g_autofree gchar *name = g_strdup_printf ("load_pipeline_c%d", (gint) getpid ());
+
+  return ml_agent_pipeline_set_description (name, "videotestsrc ! fakesink", NULL);
+}
+
+/**
+ * @brief One launch-destroy cycle, the heaviest call of the mix.
+ */
+static gint
+op_pipeline_launch (guint iter)
+{
+  gint64 id = 0;
+  gint ret;
+
+  ret = ml_agent_pipeline_launch ("load_pipeline_0", &id, NULL);
+  if (ret != 0)
+    return ret;
+
+  return ml_agent_pipeline_destroy (id, NULL);
+}
+
+/**
+ * @brief The table of load-mix methods.
+ */
+static const struct
+{
+  const gchar *name;
+  load_op_func func;
+} load_ops[] = {
+  { "model_get", op_model_get },
+  { "model_list", op_model_list },
+  { "model_register", op_model_register },
+  { "pipeline_get", op_pipeline_get },
+  { "pipeline_set", op_pipeline_set },
+  { "pipeline_launch", op_pipeline_launch },
+};
+
+/**
+ * @brief The parsed call mix as cumulative weights over load_ops.
+ */
+static guint mix_weights[G_N_ELEMENTS (load_ops)];
+static guint mix_total = 0U;
+
+/**
+ * @brief Parse the <method>:<weight> mix option into mix_weights.
+ * @return TRUE if the mix is valid and has at least one positive weight.
+ */
+static gboolean
+parse_mix (const gchar *mix)
+{
+  g_auto (GStrv) pairs = g_strsplit (mix, ",", -1);
+  guint i, j;
+
+  for (i = 0; pairs[i]; i++) {
+    g_auto (GStrv) kv = g_strsplit (pairs[i], ":", 2);
+
+    if (!kv[0] || !kv[1])
+      return FALSE;
+
+    for (j = 0; j < G_N_ELEMENTS (load_ops); j++) {
+      if (g_str_equal (kv[0], load_ops[j].name)) {
+        mix_weights[j] = (guint) g_ascii_strtoull (kv[1], NULL, 10);
+        break;
+      }
+    }
+
+    if (j >= G_N_ELEMENTS (load_ops)) {
+      g_printerr ("Unknown method '%s' in the mix.\n", kv[0]);
+      return FALSE;
+    }
+  }
+
+  for (j = 0; j < G_N_ELEMENTS (load_ops); j++)
+    mix_total += mix_weights[j];
+
+  return (mix_total > 0U);
+}
+
+/**
+ * @brief Pick the next method of the mix with weighted sampling.
+ */
+static guint
+pick_op (GRand *rand)
+{
+  guint roll = (guint) g_rand_int_range (rand, 0, (gint32) mix_total);
+  guint j;
+
+  for (j = 0; j < G_N_ELEMENTS (load_ops); j++) {
+    if (mix_weights[j] > roll)
+      return j;
+    roll -= mix_weights[j];
+  }
+
+  return 0U;
+}
+
+/**
+ * @brief The main routine of one client process. It issues the mix until
+ * the deadline and writes one line per method to the result file:
+ *   <method> <errs> <latency_us>...
+ * @details The client waits for the go-signal on the pipe before the
+ * first call, so it never inherits a D-Bus connection from the parent
+ * and opens its own like a real client process would.
+ */
+static void
+run_client (const gchar *result_path, gint go_fd, gint duration)
+{
+  std::vector<gint64> latencies[G_N_ELEMENTS (load_ops)];
+  guint errs[G_N_ELEMENTS (load_ops)] = { 0U };
+  g_autoptr (GRand) rand = g_rand_new_with_seed ((guint32) getpid ());
+  gint64 start, deadline;
+  guint iter, j;
+  gchar go = 0;
+  FILE *fp;
+
+  if (read (go_fd, &go, 1) != 1 || go != 'G')
+    _exit (0);
+  close (go_fd);
+
+  deadline = g_get_monotonic_time () + (gint64) duration * G_USEC_PER_SEC;
+  for (iter = 0U; g_get_monotonic_time () < deadline; iter++) {
+    j = pick_op (rand);
+
+    start = g_get_monotonic_time ();
+    if (load_ops[j].func (iter) != 0)
+      errs[j]++;
+    latencies[j].push_back (g_get_monotonic_time () - start);
+  }
+
+  fp = fopen (result_path, "w");
+  if (!fp)
+    _exit (1);
+
+  for (j = 0; j < G_N_ELEMENTS (load_ops); j++) {
+    fprintf (fp, "%s %u", load_ops[j].name, errs[j]);
+    for (std::vector<gint64>::size_type k = 0; k < latencies[j].size (); k++)
+      fprintf (fp, " %" G_GINT64_FORMAT, latencies[j][k]);
+    fprintf (fp, "\n");
+  }
+
+  fclose (fp);
+  _exit (0);
+}
+
+/**
+ * @brief Find the pid of the agent daemon by scanning /proc.
+ * @return The pid, or 0 if no mlops-agent process is found.
+ */
+static gint
+find_daemon_pid (void)
+{
+  g_autoptr (GDir) dir = g_dir_open ("/proc", 0, NULL);
+  const gchar *entry;
+
+  if (!dir)
+    return 0;
+
+  while ((entry = g_dir_read_name (dir)) != NULL) {
+    g_autofree gchar *comm_path = NULL;
+    g_autofree gchar *comm = NULL;
+
+    if (!g_ascii_isdigit (entry[0]))
+      continue;
+
+    comm_path = g_build_filename ("/proc", entry, "comm", NULL);
+    if (!g_file_get_contents (comm_path, &comm, NULL, NULL))
+      continue;
+
+    if (g_str_has_prefix (comm, "mlops-agent"))
+      return (gint) g_ascii_strtoll (entry, NULL, 10);
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Read the resident set size of the given process in kilobytes.
+ * @return The RSS in kB, or 0 on failure.
+ */
+static gint64
+read_rss_kb (gint pid)
+{
+  g_autofree gchar *status_path = g_strdup_printf ("/proc/%d/status", pid);
+  g_autofree gchar *status = NULL;
+  gchar *line;
+
+  if (!g_file_get_contents (status_path, &status, NULL, NULL))
+    return 0;
+
+  line = g_strstr_len (status, -1, "VmRSS:");
+  if (!line)
+    return 0;
+
+  return g_ascii_strtoll (line + strlen ("VmRSS:"), NULL, 10);
+}
+
+/**
+ * @brief Merge the per-client result files and print one line per method.
+ */
+static void
+report (const gchar *result_dir, gint clients, gint duration)
+{
+  guint j;
+
+  for (j = 0; j < G_N_ELEMENTS (load_ops); j++) {
+    std::vector<gint64> merged;
+    guint errs = 0U;
+    gint c;
+
+    for (c = 0; c < clients; c++) {
+      g_autofree gchar *result_path
+          = g_strdup_printf ("%s/client_%d.log", result_dir, c);
+      g_autofree gchar *contents = NULL;
+      g_auto (GStrv) lines = NULL;
+      gchar *cursor;
+      guint l;
+
+      if (!g_file_get_contents (result_path, &contents, NULL, NULL))
+        continue;
+
+      lines = g_strsplit (contents, "\n", -1);
+      for (l = 0; lines[l]; l++) {
+        if (!g_str_has_prefix (lines[l], load_ops[j].name) ||
+            lines[l][strlen (load_ops[j].name)] != ' ')
+          continue;
+
+        cursor = lines[l] + strlen (load_ops[j].name);
+        errs += (guint) g_ascii_strtoull (cursor, &cursor, 10);
+        while (*cursor) {
+          gchar *endp = NULL;
+          gint64 value = g_ascii_strtoll (cursor, &endp, 10);
+
+          if (endp == cursor)
+            break;
+          merged.push_back (value);
+          cursor = endp;
+        }
+        break;
+      }
+    }
+
+    if (merged.empty ())
+      continue;
+
+    std::sort (merged.begin (), merged.end ());
+
+    const std::vector<gint64>::size_type count = merged.size ();
+    g_print ("LOAD,%s,clients=%d,count=%" G_GSIZE_FORMAT ",errs=%u,"
+             "ops_per_sec=%.1f,p50_us=%" G_GINT64_FORMAT ",p95_us=%" G_GINT64_FORMAT
+             ",p99_us=%" G_GINT64_FORMAT ",max_us=%" G_GINT64_FORMAT "\n",
+        load_ops[j].name, clients, (gsize) count, errs,
+        (gdouble) count / (gdouble) MAX (duration, 1),
+        merged[count / 2], merged[(std::vector<gint64>::size_type) (count * 0.95)],
+        merged[(std::vector<gint64>::size_type) (count * 0.99)], merged[count - 1]);
+  }
+}
+
+/**
+ * @brief Register the fixtures the mix reads, probing daemon reachability.
+ * @return 0 on success. Otherwise a negative error value.
+ */
+static gint
+setup_fixtures (void)
+{
+  guint version = 0U;
+  gint ret;
+
+  ret = ml_agent_pipeline_set_description ("load_pipeline_0",
+      "videotestsrc ! fakesink", NULL);
+  if (ret != 0)
+    return ret;
+
+  return ml_agent_model_register ("load_model_0", "/opt/load/model_0.tflite",
+      TRUE, "load fixture", "", &version, NULL);
+}
+
+/**
+ * @brief Main routine of the load harness.
+ */
+int
+main (int argc, char **argv)
+{
+  static GOptionEntry entries[] = {
+    { "clients", 'n', 0, G_OPTION_ARG_INT, &opt_clients,
+        "Number of client processes", NULL },
+    { "duration", 'd', 0, G_OPTION_ARG_INT, &opt_duration,
+        "Run duration in seconds", NULL },
+    { "mix", 'x', 0, G_OPTION_ARG_STRING, &opt_mix,
+        "Call mix as <method>:<weight> pairs", NULL },
+    { "daemon-pid", 'P', 0, G_OPTION_ARG_INT, &opt_daemon_pid,
+        "Pid of the agent daemon for RSS sampling", NULL },
+    { NULL }
+  };
+
+  g_autoptr (GOptionContext) context = g_option_context_new (NULL);
+  g_autofree gchar *result_dir = NULL;
+  GError *err = NULL;
+  std::vector<pid_t> children;
+  gint go_pipe[2];
+  gint c, t;
+
+  g_option_context_add_main_entries (context, entries, NULL);
+  if (!g_option_context_parse (context, &argc, &argv, &err)) {
+    g_printerr ("Fail to option parsing: %s\n", err->message);
+    g_clear_error (&err);
+    return 1;
+  }
+
+  if (opt_clients < 1 || opt_duration < 1) {
+    g_printerr ("The numbers of clients and seconds should be positive.\n");
+    return 1;
+  }
+
+  if (!parse_mix (opt_mix ? opt_mix : LOAD_DEFAULT_MIX)) {
+    g_printerr ("Invalid call mix.\n");
+    return 1;
+  }
+
+  result_dir = g_dir_make_tmp ("ml_agent_load_XXXXXX", NULL);
+  if (!result_dir) {
+    g_printerr ("Failed to create a temporary directory for the results.\n");
+    return 1;
+  }
+
+  /* Fork before the first D-Bus call, each client opens its own connection. */
+  if (pipe (go_pipe) != 0) {
+    g_printerr ("Failed to create the go-signal pipe.\n");
+    return 1;
+  }
+
+  for (c = 0; c < opt_clients; c++) {
+    g_autofree gchar *result_path = g_strdup_printf ("%s/client_%d.log", result_dir, c);
+    pid_t pid = fork ();
+
+    if (pid == 0) {
+      close (go_pipe[1]);
+      run_client (result_path, go_pipe[0], opt_duration);
+    } else if (pid > 0) {
+      children.push_back (pid);
+    } else {
+      g_printerr ("Failed to fork client %d.\n", c);
+    }
+  }
+  close (go_pipe[0]);
+
+  if (setup_fixtures () != 0) {
+    /* No reachable daemon, release the clients with EOF and skip. */
+    close (go_pipe[1]);
+    for (std::vector<pid_t>::size_type i = 0; i < children.size (); i++)
+      waitpid (children[i], NULL, 0);
+    g_rmdir (result_dir);
+    g_print ("LOAD,skipped=1\n");
+    return 0;
+  }
+
+  if (opt_daemon_pid == 0)
+    opt_daemon_pid = find_daemon_pid ();
+
+  for (std::vector<pid_t>::size_type i = 0; i < children.size (); i++) {
+    if (write (go_pipe[1], "G", 1) != 1)
+      g_printerr ("Failed to release a client.\n");
+  }
+  close (go_pipe[1]);
+
+  /* Sample the daemon RSS once per second while the clients run. */
+  for (t = 1; t <= opt_duration; t++) {
+    g_usleep (G_USEC_PER_SEC);
+    if (opt_daemon_pid > 0)
+      g_print ("LOAD_RSS,t_s=%d,rss_kb=%" G_GINT64_FORMAT "\n",
+          t, read_rss_kb (opt_daemon_pid));
+  }
+
+  for (std::vector<pid_t>::size_type i = 0; i < children.size (); i++)
+    waitpid (children[i], NULL, 0);
+
+  report (result_dir, opt_clients, opt_duration);
+
+  for (c = 0; c < opt_clients; c++) {
+    g_autofree gchar *result_path = g_strdup_printf ("%s/client_%d.log", result_dir, c);
+    g_unlink (result_path);
+  }
+  g_rmdir (result_dir);
+
+  return 0;
+}
@@ -8,7 +8,9 @@
  */
 
 #include <gtest/gtest.h>
+#include <errno.h>
 #include <gio/gio.h>
+#include <glib/gstdio.h>
 
 #include "log.h"
 #include "service-db.hh"
@@ -675,6 +677,559 @@ TEST (serviceDBNotInitalized, delete_resource_n)
   }
 }
 
+/**
+ * @brief Check the paged model listing with filter and activation state.
+ */
+TEST (serviceDB, list_models_scenario)
+{
+  MLServiceDB db (TEST_DB_PATH);
+
+  db.connectDB ();
+
+  /* Test condition, remove all models with name 'listed'. */
+  try {
+    db.delete_model ("listed", 0U);
+  } catch (const std::exception &e) {
+    /* none registered */
+  }
+
+  try {
+    gchar *model_list;
+    guint version;
+
+    db.set_model ("listed", "listed_model1", false, "", "", &version);
+    db.set_model ("listed", "listed_model2", false, "", "", &version);
+    db.set_model ("listed", "listed_model3", true, "", "", &version);
+    db.set_model ("listed", "listed_model4", false, "", "", &version);
+    db.set_model ("listed", "listed_model5", false, "", "", &version);
+
+    /* The first page holds the first two versions only. */
+    db.list_models ("listed", -1, 0U, 2U, &model_list);
+    EXPECT_TRUE (g_strstr_len (model_list, -1, "\"version\":\"1\"") != NULL);
+    EXPECT_TRUE (g_strstr_len (model_list, -1, "\"version\":\"2\"") != NULL);
+    EXPECT_TRUE (g_strstr_len (model_list, -1, "\"version\":\"3\"") == NULL);
+    g_free (model_list);
+
+    /* The last page is cut off at the end of the rows. */
+    db.list_models ("listed", -1, 4U, 2U, &model_list);
+    EXPECT_TRUE (g_strstr_len (model_list, -1, "\"version\":\"5\"") != NULL);
+    EXPECT_TRUE (g_strstr_len (model_list, -1, "\"version\":\"4\"") == NULL);
+    g_free (model_list);
+
+    /* An offset past the end yields an empty list, not an error. */
+    db.list_models ("listed", -1, 5U, 2U, &model_list);
+    EXPECT_STREQ (model_list, "[]");
+    g_free (model_list);
+
+    /* The activation state filters to the active or the inactive rows. */
+    db.list_models ("listed", 1, 0U, 10U, &model_list);
+    EXPECT_TRUE (g_strstr_len (model_list, -1, "\"version\":\"3\"") != NULL);
+    EXPECT_TRUE (g_strstr_len (model_list, -1, "\"version\":\"1\"") == NULL);
+    g_free (model_list);
+
+    db.list_models ("listed", 0, 0U, 10U, &model_list);
+    EXPECT_TRUE (g_strstr_len (model_list, -1, "\"version\":\"3\"") == NULL);
+    EXPECT_TRUE (g_strstr_len (model_list, -1, "\"version\":\"4\"") != NULL);
+    g_free (model_list);
+
+    /* A filter matching no model yields an empty list, not an error. */
+    db.list_models ("no_such_model", -1, 0U, 10U, &model_list);
+    EXPECT_STREQ (model_list, "[]");
+    g_free (model_list);
+
+    db.delete_model ("listed", 0U);
+  } catch (const std::exception &e) {
+    FAIL ();
+  }
+
+  db.disconnectDB ();
+}
+
+/**
+ * @brief Negative test for list_models. Invalid param case (zero limit or NULL list).
+ */
+TEST (serviceDB, list_models_n)
+{
+  MLServiceDB db (TEST_DB_PATH);
+
+  db.connectDB ();
+
+  try {
+    gchar *model_list;
+    db.list_models ("", -1, 0U, 0U, &model_list);
+    FAIL ();
+  } catch (const std::exception &e) {
+    /* expected */
+  }
+
+  try {
+    db.list_models ("", -1, 0U, 10U, NULL);
+    FAIL ();
+  } catch (const std::exception &e) {
+    /* expected */
+  }
+
+  db.disconnectDB ();
+}
+
+/**
+ * @brief Check set_model_if_changed. An unchanged file reuses its version, a changed file gets a new one.
+ */
+TEST (serviceDB, set_model_if_changed_scenario)
+{
+  MLServiceDB db (TEST_DB_PATH);
+  g_autofree gchar *model_file = g_build_filename (".", "unchanged_model.bin", NULL);
+  guint version, reused;
+
+  db.connectDB ();
+
+  /* Test condition, remove all models with name 'unchanged'. */
+  try {
+    db.delete_model ("unchanged", 0U);
+  } catch (const std::exception &e) {
+    /* none registered */
+  }
+
+  ASSERT_TRUE (g_file_set_contents (model_file, "model-content", -1, NULL));
+
+  try {
+    gchar *model_info;
+
+    db.set_model_if_changed ("unchanged", model_file, false, "desc", "", &version);
+    EXPECT_EQ (version, 1U);
+
+    /* The unchanged file reuses the registered version instead of adding one. */
+    db.set_model_if_changed ("unchanged", model_file, false, "desc", "", &reused);
+    EXPECT_EQ (reused, version);
+
+    /* The activation request is honored for the reused version. */
+    db.set_model_if_changed ("unchanged", model_file, true, "desc", "", &reused);
+    EXPECT_EQ (reused, version);
+    db.get_model ("unchanged", -1, &model_info);
+    EXPECT_TRUE (g_strstr_len (model_info, -1, "\"version\":\"1\"") != NULL);
+    g_free (model_info);
+
+    /* A changed file registers a new version. */
+    ASSERT_TRUE (g_file_set_contents (model_file, "model-content-changed!", -1, NULL));
+    db.set_model_if_changed ("unchanged", model_file, false, "desc", "", &version);
+    EXPECT_EQ (version, 2U);
+
+    db.delete_model ("unchanged", 0U);
+  } catch (const std::exception &e) {
+    FAIL ();
+  }
+
+  g_remove (model_file);
+  db.disconnectDB ();
+}
+
+/**
+ * @brief Check set_model_if_changed with a file that cannot be examined. Every call registers a new version.
+ */
+TEST (serviceDB, set_model_if_changed_no_file_scenario)
+{
+  MLServiceDB db (TEST_DB_PATH);
+  guint version;
+
+  db.connectDB ();
+
+  /* Test condition, remove all models with name 'missing'. */
+  try {
+    db.delete_model ("missing", 0U);
+  } catch (const std::exception &e) {
+    /* none registered */
+  }
+
+  try {
+    db.set_model_if_changed ("missing", "no_such_model_file", false, "", "", &version);
+    EXPECT_EQ (version, 1U);
+
+    /* Without a fingerprint there is no reuse, the call falls back to set_model. */
+    db.set_model_if_changed ("missing", "no_such_model_file", false, "", "", &version);
+    EXPECT_EQ (version, 2U);
+
+    db.delete_model ("missing", 0U);
+  } catch (const std::exception &e) {
+    FAIL ();
+  }
+
+  db.disconnectDB ();
+}
+
+/**
+ * @brief Negative test for set_model_if_changed. Invalid param case (empty name, model or NULL version).
+ */
+TEST (serviceDB, set_model_if_changed_n)
+{
+  MLServiceDB db (TEST_DB_PATH);
+  guint version;
+
+  db.connectDB ();
+
+  try {
+    db.set_model_if_changed ("", "model", false, "", "", &version);
+    FAIL ();
+  } catch (const std::exception &e) {
+    /* expected */
+  }
+
+  try {
+    db.set_model_if_changed ("test", "", false, "", "", &version);
+    FAIL ();
+  } catch (const std::exception &e) {
+    /* expected */
+  }
+
+  try {
+    db.set_model_if_changed ("test", "model", false, "", "", NULL);
+    FAIL ();
+  } catch (const std::exception &e) {
+    /* expected */
+  }
+
+  db.disconnectDB ();
+}
+
+/**
+ * @brief Execute the given SQL directly on the database file in the directory.
+ */
+static bool
+_raw_db_exec (const gchar *dir, const gchar *sql)
+{
+  g_autofree gchar *db_file = g_strdup_printf ("%s/.ml-service.db", dir);
+  sqlite3 *db = nullptr;
+  int rc;
+
+  if (sqlite3_open (db_file, &db) != SQLITE_OK) {
+    sqlite3_close (db);
+    return false;
+  }
+
+  rc = sqlite3_exec (db, sql, nullptr, nullptr, nullptr);
+  sqlite3_close (db);
+  return (rc == SQLITE_OK);
+}
+
+/**
+ * @brief Run the given scalar query directly on the database file in the directory.
+ * @return The integer value of the first row, or -1 on failure.
+ */
+static gint
+_raw_db_query_int (const gchar *dir, const gchar *sql)
+{
+  g_autofree gchar *db_file = g_strdup_printf ("%s/.ml-service.db", dir);
+  sqlite3 *db = nullptr;
+  sqlite3_stmt *res = nullptr;
+  gint value = -1;
+
+  if (sqlite3_open (db_file, &db) != SQLITE_OK) {
+    sqlite3_close (db);
+    return -1;
+  }
+
+  if (sqlite3_prepare_v2 (db, sql, -1, &res, nullptr) == SQLITE_OK
+      && sqlite3_step (res) == SQLITE_ROW)
+    value = sqlite3_column_int (res, 0);
+
+  if (res)
+    sqlite3_finalize (res);
+  sqlite3_close (db);
+  return value;
+}
+
+/**
+ * @brief Create a database in the directory holding two versions of model 'mig',
+ * then rewrite its model table into the v1 shape without the fingerprint column.
+ */
+static void
+_prepare_v1_model_db (const gchar *dir)
+{
+  MLServiceDB db (dir);
+  guint version;
+
+  db.connectDB ();
+  db.set_model ("mig", "mig_model1", false, "mig_desc1", "", &version);
+  db.set_model ("mig", "mig_model2", true, "mig_desc2", "", &version);
+  db.disconnectDB ();
+
+  EXPECT_TRUE (_raw_db_exec (dir,
+      "CREATE TABLE tblModelOld AS SELECT key, version, active, path, description, app_info FROM tblModel;"
+      "DROP TABLE tblModel;"
+      "ALTER TABLE tblModelOld RENAME TO tblModel;"
+      "UPDATE tblMLDBInfo SET version = 1 WHERE name = 'tblModel';"));
+}
+
+/**
+ * @brief Check the model table migration from the v1 schema without the fingerprint column.
+ */
+TEST (serviceDBMigration, migrate_model_v1_scenario)
+{
+  g_autofree gchar *dir = g_dir_make_tmp ("ml-agent-test-XXXXXX", NULL);
+  ASSERT_TRUE (dir != NULL);
+
+  _prepare_v1_model_db (dir);
+
+  /* Reopening the database migrates the model table to the current schema. */
+  try {
+    MLServiceDB db (dir);
+    gchar *model_info;
+    gchar *pos;
+
+    db.connectDB ();
+
+    db.get_model ("mig", 0, &model_info);
+    pos = g_strstr_len (model_info, -1, "mig_model1");
+    EXPECT_TRUE (pos != NULL);
+    pos = g_strstr_len (model_info, -1, "mig_model2");
+    EXPECT_TRUE (pos != NULL);
+    g_free (model_info);
+
+    /* The active flag of the second version survives the migration. */
+    db.get_model ("mig", -1, &model_info);
+    pos = g_strstr_len (model_info, -1, "mig_model2");
+    EXPECT_TRUE (pos != NULL);
+    g_free (model_info);
+
+    db.disconnectDB ();
+  } catch (const std::exception &e) {
+    FAIL ();
+  }
+
+  EXPECT_EQ (_raw_db_query_int (dir,
+      "SELECT version FROM tblMLDBInfo WHERE name = 'tblModel';"), 2);
+  EXPECT_EQ (_raw_db_query_int (dir,
+      "SELECT COUNT(*) FROM sqlite_master WHERE type = 'index' AND name LIKE 'idx_model_%';"), 3);
+  EXPECT_EQ (_raw_db_query_int (dir,
+      "SELECT COUNT(*) FROM sqlite_master WHERE name = 'tblModelMigrate';"), 0);
+}
+
+/**
+ * @brief Check the model table migration from a v1 table that got the fingerprint column appended in place.
+ */
+TEST (serviceDBMigration, migrate_model_v1_fingerprint_scenario)
+{
+  g_autofree gchar *dir = g_dir_make_tmp ("ml-agent-test-XXXXXX", NULL);
+  ASSERT_TRUE (dir != NULL);
+
+  _prepare_v1_model_db (dir);
+  EXPECT_TRUE (_raw_db_exec (dir,
+      "ALTER TABLE tblModel ADD COLUMN fingerprint TEXT;"
+      "UPDATE tblModel SET fingerprint = 'legacy-fp';"));
+
+  try {
+    MLServiceDB db (dir);
+    gchar *model_info;
+    gchar *pos;
+
+    db.connectDB ();
+
+    db.get_model ("mig", 0, &model_info);
+    pos = g_strstr_len (model_info, -1, "mig_model1");
+    EXPECT_TRUE (pos != NULL);
+    pos = g_strstr_len (model_info, -1, "mig_model2");
+    EXPECT_TRUE (pos != NULL);
+    g_free (model_info);
+
+    db.disconnectDB ();
+  } catch (const std::exception &e) {
+    FAIL ();
+  }
+
+  /* The fingerprint values appended in place survive the migration. */
+  EXPECT_EQ (_raw_db_query_int (dir,
+      "SELECT COUNT(*) FROM tblModel WHERE fingerprint = 'legacy-fp';"), 2);
+  EXPECT_EQ (_raw_db_query_int (dir,
+      "SELECT version FROM tblMLDBInfo WHERE name = 'tblModel';"), 2);
+}
+
+/**
+ * @brief Negative test for the model table migration. A blocked rename leaves the old table intact.
+ */
+TEST (serviceDBMigration, migrate_model_blocked_n)
+{
+  g_autofree gchar *dir = g_dir_make_tmp ("ml-agent-test-XXXXXX", NULL);
+  ASSERT_TRUE (dir != NULL);
+
+  _prepare_v1_model_db (dir);
+
+  /* The leftover rename target makes the migration fail. */
+  EXPECT_TRUE (_raw_db_exec (dir, "CREATE TABLE tblModelMigrate (dummy INTEGER);"));
+
+  try {
+    MLServiceDB db (dir);
+    db.connectDB ();
+    FAIL ();
+  } catch (const std::exception &e) {
+    /* expected */
+  }
+
+  /* The old table keeps its rows, its v1 shape, and its recorded version. */
+  EXPECT_EQ (_raw_db_query_int (dir, "SELECT COUNT(*) FROM tblModel;"), 2);
+  EXPECT_EQ (_raw_db_query_int (dir,
+      "SELECT version FROM tblMLDBInfo WHERE name = 'tblModel';"), 1);
+  EXPECT_EQ (_raw_db_query_int (dir,
+      "SELECT COUNT(*) FROM pragma_table_info('tblModel') WHERE name = 'fingerprint';"), 0);
+}
+
+/**
+ * @brief Check the batch model registration. All models commit in a single call.
+ */
+TEST (serviceDBBatch, model_add_many_scenario)
+{
+  g_autofree gchar *dir = g_dir_make_tmp ("ml-agent-test-XXXXXX", NULL);
+  ASSERT_TRUE (dir != NULL);
+
+  svcdb_initialize (dir);
+
+  GVariantBuilder builder;
+  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a(ssbss)"));
+  g_variant_builder_add (&builder, "(ssbss)", "batch", "batch_model1", FALSE, "desc1", "");
+  g_variant_builder_add (&builder, "(ssbss)", "batch", "batch_model2", TRUE, "desc2", "");
+  g_variant_builder_add (&builder, "(ssbss)", "batch", "batch_model3", FALSE, "desc3", "");
+
+  g_autoptr (GVariant) models = g_variant_ref_sink (g_variant_builder_end (&builder));
+  GVariant *versions = NULL;
+  guint version = 0U;
+  gchar *model_info = NULL;
+
+  EXPECT_EQ (svcdb_model_add_many (models, &versions), 0);
+  ASSERT_TRUE (versions != NULL);
+  g_variant_ref_sink (versions);
+  EXPECT_EQ (g_variant_n_children (versions), 3U);
+  g_variant_get_child (versions, 2, "u", &version);
+  EXPECT_EQ (version, 3U);
+  g_variant_unref (versions);
+
+  /* The second model stays the activated one. */
+  EXPECT_EQ (svcdb_model_get_activated ("batch", &model_info), 0);
+  EXPECT_TRUE (g_strstr_len (model_info, -1, "batch_model2") != NULL);
+  g_free (model_info);
+
+  svcdb_finalize ();
+}
+
+/**
+ * @brief Check the batch model registration with an empty batch and invalid params.
+ */
+TEST (serviceDBBatch, model_add_many_empty)
+{
+  g_autofree gchar *dir = g_dir_make_tmp ("ml-agent-test-XXXXXX", NULL);
+  ASSERT_TRUE (dir != NULL);
+
+  svcdb_initialize (dir);
+
+  GVariantBuilder builder;
+  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a(ssbss)"));
+
+  g_autoptr (GVariant) models = g_variant_ref_sink (g_variant_builder_end (&builder));
+  GVariant *versions = NULL;
+
+  /* An empty batch is not an error, it just registers nothing. */
+  EXPECT_EQ (svcdb_model_add_many (models, &versions), 0);
+  ASSERT_TRUE (versions != NULL);
+  g_variant_ref_sink (versions);
+  EXPECT_EQ (g_variant_n_children (versions), 0U);
+  g_variant_unref (versions);
+
+  EXPECT_EQ (svcdb_model_add_many (NULL, &versions), -EINVAL);
+  EXPECT_EQ (svcdb_model_add_many (models, NULL), -EINVAL);
+
+  svcdb_finalize ();
+}
+
+/**
+ * @brief Negative test for the batch model registration. A mid-batch failure registers nothing.
+ */
+TEST (serviceDBBatch, model_add_many_rollback_n)
+{
+  g_autofree gchar *dir = g_dir_make_tmp ("ml-agent-test-XXXXXX", NULL);
+  ASSERT_TRUE (dir != NULL);
+
+  svcdb_initialize (dir);
+
+  GVariantBuilder builder;
+  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a(ssbss)"));
+  g_variant_builder_add (&builder, "(ssbss)", "batch", "batch_model1", FALSE, "desc1", "");
+  g_variant_builder_add (&builder, "(ssbss)", "batch", "", FALSE, "desc2", "");
+  g_variant_builder_add (&builder, "(ssbss)", "batch", "batch_model3", FALSE, "desc3", "");
+
+  g_autoptr (GVariant) models = g_variant_ref_sink (g_variant_builder_end (&builder));
+  GVariant *versions = NULL;
+  gchar *model_info = NULL;
+
+  EXPECT_EQ (svcdb_model_add_many (models, &versions), -EINVAL);
+  ASSERT_TRUE (versions != NULL);
+  g_variant_ref_sink (versions);
+  EXPECT_EQ (g_variant_n_children (versions), 0U);
+  g_variant_unref (versions);
+
+  /* The models before the failing entry are rolled back, too. */
+  EXPECT_NE (svcdb_model_get ("batch", 0U, &model_info), 0);
+
+  svcdb_finalize ();
+}
+
+/**
+ * @brief Check the batch resource registration. All resources commit in a single call.
+ */
+TEST (serviceDBBatch, resource_add_many_scenario)
+{
+  g_autofree gchar *dir = g_dir_make_tmp ("ml-agent-test-XXXXXX", NULL);
+  ASSERT_TRUE (dir != NULL);
+
+  svcdb_initialize (dir);
+
+  GVariantBuilder builder;
+  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a(ssss)"));
+  g_variant_builder_add (&builder, "(ssss)", "batchres", "res_path1", "desc1", "");
+  g_variant_builder_add (&builder, "(ssss)", "batchres", "res_path2", "desc2", "");
+
+  g_autoptr (GVariant) resources = g_variant_ref_sink (g_variant_builder_end (&builder));
+  gchar *res_info = NULL;
+
+  EXPECT_EQ (svcdb_resource_add_many (resources), 0);
+
+  EXPECT_EQ (svcdb_resource_get ("batchres", &res_info), 0);
+  EXPECT_TRUE (g_strstr_len (res_info, -1, "res_path1") != NULL);
+  EXPECT_TRUE (g_strstr_len (res_info, -1, "res_path2") != NULL);
+  g_free (res_info);
+
+  /* An empty batch is not an error, a NULL batch is. */
+  GVariantBuilder empty_builder;
+  g_variant_builder_init (&empty_builder, G_VARIANT_TYPE ("a(ssss)"));
+  g_autoptr (GVariant) empty = g_variant_ref_sink (g_variant_builder_end (&empty_builder));
+  EXPECT_EQ (svcdb_resource_add_many (empty), 0);
+  EXPECT_EQ (svcdb_resource_add_many (NULL), -EINVAL);
+
+  svcdb_finalize ();
+}
+
+/**
+ * @brief Negative test for the batch resource registration. A mid-batch failure registers nothing.
+ */
+TEST (serviceDBBatch, resource_add_many_rollback_n)
+{
+  g_autofree gchar *dir = g_dir_make_tmp ("ml-agent-test-XXXXXX", NULL);
+  ASSERT_TRUE (dir != NULL);
+
+  svcdb_initialize (dir);
+
+  GVariantBuilder builder;
+  g_variant_builder_init (&builder, G_VARIANT_TYPE ("a(ssss)"));
+  g_variant_builder_add (&builder, "(ssss)", "batchres", "res_path1", "desc1", "");
+  g_variant_builder_add (&builder, "(ssss)", "batchres", "", "desc2", "");
+
+  g_autoptr (GVariant) resources = g_variant_ref_sink (g_variant_builder_end (&builder));
+  gchar *res_info = NULL;
+
+  EXPECT_EQ (svcdb_resource_add_many (resources), -EINVAL);
+
+  /* The resources before the failing entry are rolled back, too. */
+  EXPECT_NE (svcdb_resource_get ("batchres", &res_info), 0);
+
+  svcdb_finalize ();
+}
+
 /**
  * @brief Main gtest
  */